@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific shared memory map objects
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace ov {
+
+/**
+ * @brief Read-only view of a file mapped to the process memory. The mapping is released with the object.
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+    virtual char* data() noexcept = 0;
+    virtual size_t size() const noexcept = 0;
+
+    /**
+     * @brief Asks the OS to read the range of the file ahead. Doesn't wait for the data, the failures are ignored
+     * @param offset Offset of the range from the beginning of the mapping
+     * @param size Size of the range in bytes
+     */
+    virtual void prefetch(size_t offset, size_t size) noexcept = 0;
+};
+
+/**
+ * @brief Maps the whole file to the process memory
+ * @param path Path to the file
+ * @return Object holding the mapping
+ * @throws std::runtime_error if the file can not be opened or mapped
+ */
+std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::wstring& path);
+
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+/**
+ * @brief Checks whether the mapped weights have to be read ahead when a model is loaded. The read-ahead is enabled by
+ * OV_MMAP_PREFETCH environment variable, it is off by default since the files bigger than the free memory would
+ * evict the other pages from the page cache
+ */
+bool is_mmap_prefetch_enabled();
+
+/**
+ * @brief Asks the OS to read the whole mapped file ahead, so the pages are mostly resident when they are accessed for
+ * the first time. Doesn't wait for the data
+ * @param mapping Mapped file
+ */
+void prefetch_mmap_object(const std::shared_ptr<ov::MappedMemory>& mapping);
+
+}  // namespace ov
@@ -0,0 +1,21 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/mmap_object.hpp"
+
+#include "openvino/util/env_util.hpp"
+
+namespace ov {
+
+bool is_mmap_prefetch_enabled() {
+    static const bool enabled = ov::util::getenv_bool("OV_MMAP_PREFETCH");
+    return enabled;
+}
+
+void prefetch_mmap_object(const std::shared_ptr<ov::MappedMemory>& mapping) {
+    // the hint is asynchronous, the OS reads the range in the background
+    mapping->prefetch(0, mapping->size());
+}
+
+}  // namespace ov
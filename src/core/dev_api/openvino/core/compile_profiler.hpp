@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+
+/**
+ * @brief Collects the compile time statistics of the transformation passes run by pass::Manager and of the
+ * plugin graph initialization stages.
+ *
+ * The profiler is enabled by OV_COMPILE_PROFILE environment variable or by enable() call. If the output path is
+ * set the records are written when the process exits: in CSV format if the path ends with ".csv" and in JSON
+ * format otherwise.
+ *
+ * Is thread safe
+ */
+class OPENVINO_API CompileProfiler {
+public:
+    struct Record {
+        std::string category;
+        std::string name;
+        /// Nesting level of the scope, e.g. passes of the nested pass::Manager have bigger depth
+        size_t depth;
+        double time_ms;
+        size_t nodes_before;
+        size_t nodes_after;
+        /// Growth of the peak resident set size of the process during the scope, 0 if unavailable
+        int64_t peak_rss_delta_kb;
+    };
+
+    /**
+     * @brief Measures one pass or stage, the record is added when the scope is destroyed
+     */
+    class OPENVINO_API Scope {
+    public:
+        Scope() = default;
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        ~Scope();
+
+        /**
+         * @brief Starts the measurement if the profiler is enabled
+         * @param category Kind of the measured entity, e.g. "pass"
+         * @param name Name of the measured entity
+         * @param count_nodes Returns the current number of the nodes in the processed graph
+         */
+        void start(std::string category, std::string name, std::function<size_t()> count_nodes);
+
+        /**
+         * @brief Drops the started measurement, e.g. if the pass was skipped
+         */
+        void discard();
+
+    private:
+        bool m_active = false;
+        std::string m_category;
+        std::string m_name;
+        std::function<size_t()> m_count_nodes;
+        size_t m_depth = 0;
+        size_t m_nodes_before = 0;
+        int64_t m_peak_rss_before = 0;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    static CompileProfiler& get();
+
+    ~CompileProfiler();
+
+    bool is_enabled() const {
+        return m_enabled;
+    }
+
+    /**
+     * @brief Enables the profiler
+     * @param path Path of the file the records are written to at exit, nothing is written if empty
+     */
+    void enable(const std::string& path = {});
+
+    void disable();
+
+    void add_record(Record record);
+
+    std::vector<Record> get_records() const;
+
+    void clear();
+
+    void dump_json(std::ostream& stream) const;
+
+    void dump_csv(std::ostream& stream) const;
+
+    /**
+     * @brief Writes the records to the file, the format is selected by the file extension
+     */
+    void dump(const std::string& path) const;
+
+private:
+    CompileProfiler();
+
+    std::atomic<bool> m_enabled{false};
+    std::string m_path;
+    mutable std::mutex m_mutex;
+    std::vector<Record> m_records;
+};
+
+}  // namespace ov
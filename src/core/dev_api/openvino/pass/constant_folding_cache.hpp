@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/core_visibility.hpp"
+#include "openvino/op/constant.hpp"
+
+namespace ov {
+namespace pass {
+
+/**
+ * @brief Keeps the results of ConstantFolding, so the same constant sub-graphs aren't evaluated again when the same
+ * model is compiled several times in the process, e.g. for several devices or configurations.
+ *
+ * The key describes a folded node: its type, attributes, output types and shapes and the identities of its input
+ * constants (a hash of the data of the original constants and the key of the folded ones). The cache is enabled by
+ * OV_CONSTANT_FOLDING_CACHE environment variable or by enable() call. If the cache directory is set (e.g. by
+ * OV_CONSTANT_FOLDING_CACHE_DIR environment variable), the results are also written to the files and reused by the
+ * other processes, the files are mapped to memory when loaded. The files are bound to the OpenVINO build number, the
+ * files of the other builds are ignored.
+ *
+ * The size of the cache directory isn't limited: the files are never removed by OpenVINO and every distinct folded
+ * result (including the ones of the other builds) adds a file, so the directory has to be cleaned up by the user.
+ *
+ * The cached constants share the data with the constants of the models, so the data must not be modified in place.
+ *
+ * Is thread safe
+ */
+class OPENVINO_API ConstantFoldingCache {
+public:
+    using Outputs = std::vector<std::shared_ptr<ov::op::v0::Constant>>;
+
+    static ConstantFoldingCache& get();
+
+    bool is_enabled() const {
+        return m_enabled;
+    }
+
+    /**
+     * @brief Enables the cache
+     * @param cache_dir Directory of the on-disk cache, the results are kept in memory only if empty. The directory
+     * isn't bounded by the capacity, it grows until it is cleaned up by the user
+     */
+    void enable(const std::string& cache_dir = {});
+
+    void disable();
+
+    /**
+     * @brief Sets the limit of the total size of the constants kept in memory, the least recently used results are
+     * dropped when it is exceeded
+     */
+    void set_capacity(size_t bytes);
+
+    /**
+     * @brief Finds the result by the key in memory and then in the cache directory
+     * @return true if the result is found, outputs are the new constants sharing the data with the cached ones
+     */
+    bool lookup(const std::string& key, Outputs& outputs);
+
+    /**
+     * @brief Adds the result to the cache, it's written to the cache directory if it is set
+     */
+    void store(const std::string& key, const Outputs& outputs);
+
+    /**
+     * @brief Drops the results kept in memory, the cache directory isn't cleaned
+     */
+    void clear();
+
+    /// Total size of the constants kept in memory
+    size_t get_size() const;
+
+    size_t get_hits() const {
+        return m_hits;
+    }
+
+    size_t get_misses() const {
+        return m_misses;
+    }
+
+private:
+    ConstantFoldingCache();
+
+    struct Entry {
+        std::string key;
+        Outputs outputs;
+        size_t size;
+    };
+
+    void add_entry(const std::string& key, const Outputs& outputs);
+    std::string get_file_path(const std::string& key) const;
+
+    std::atomic<bool> m_enabled{false};
+    std::atomic<size_t> m_hits{0};
+    std::atomic<size_t> m_misses{0};
+    mutable std::mutex m_mutex;
+    std::string m_cache_dir;
+    size_t m_capacity;
+    size_t m_size = 0;
+    // the most recently used entries are at the front
+    std::list<Entry> m_entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+};
+
+}  // namespace pass
+}  // namespace ov
@@ -7,6 +7,8 @@
 #include <functional>
 #include <memory>
 #include <set>
+#include <type_traits>
+#include <unordered_set>
 
 #include "openvino/pass/pass.hpp"
 #include "openvino/pass/pattern/matcher.hpp"
@@ -139,6 +141,19 @@ public:
         return m_matcher;
     }
 
+    using Factory = std::function<std::shared_ptr<MatcherPass>()>;
+
+    /// \brief Set the function which creates a new instance of the pass with the same
+    /// constructor arguments. Is set automatically by GraphRewrite::add_matcher and
+    /// pass::Manager::register_pass when the pass can be re-created.
+    void set_factory(const Factory& factory) {
+        m_factory = factory;
+    }
+
+    /// \brief Creates a new independent instance of the pass sharing the same PassConfig.
+    /// \return New pass instance or nullptr if the pass can't be re-created
+    std::shared_ptr<MatcherPass> clone();
+
 protected:
     void register_matcher(const std::shared_ptr<pattern::Matcher>& m,
                           const matcher_pass_callback& callback,
@@ -150,8 +165,53 @@ private:
     handler_callback m_handler;
     std::shared_ptr<pattern::Matcher> m_matcher;
     NodeRegistry m_new_nodes;
+    Factory m_factory;
 };
 
+namespace detail {
+template <bool... B>
+struct bool_pack {};
+template <bool... B>
+using all_true = std::is_same<bool_pack<true, B...>, bool_pack<B..., true>>;
+
+// The pass is re-created from the copies of the constructor arguments, so the passes which take
+// non-const references to the external state are never re-created
+template <typename T, class... Args>
+using is_matcher_pass_recreatable =
+    all_true<std::is_base_of<MatcherPass, T>::value,
+             std::is_copy_constructible<typename std::decay<Args>::type>::value...,
+             std::is_constructible<T, const typename std::decay<Args>::type&...>::value>;
+
+template <typename T, class... Args>
+std::shared_ptr<MatcherPass> create_matcher_pass(const Args&... args) {
+    return std::make_shared<T>(args...);
+}
+
+template <typename T, class... Args>
+typename std::enable_if<is_matcher_pass_recreatable<T, Args...>::value, MatcherPass::Factory>::type
+make_matcher_pass_factory(Args&&... args) {
+    return std::bind(&create_matcher_pass<T, typename std::decay<Args>::type...>, std::forward<Args>(args)...);
+}
+
+template <typename T, class... Args>
+typename std::enable_if<!is_matcher_pass_recreatable<T, Args...>::value, MatcherPass::Factory>::type
+make_matcher_pass_factory(Args&&...) {
+    return nullptr;
+}
+
+template <typename T>
+typename std::enable_if<std::is_base_of<MatcherPass, T>::value>::type set_matcher_pass_factory(
+    const std::shared_ptr<T>& pass,
+    const MatcherPass::Factory& factory) {
+    pass->set_factory(factory);
+}
+
+template <typename T>
+typename std::enable_if<!std::is_base_of<MatcherPass, T>::value>::type set_matcher_pass_factory(
+    const std::shared_ptr<T>&,
+    const MatcherPass::Factory&) {}
+}  // namespace detail
+
 /// \brief GraphRewrite is a container for MatcherPasses that allows to run them on Function
 /// in
 /// efficient way
@@ -204,7 +264,9 @@ public:
               typename std::enable_if<std::is_base_of<pass::MatcherPass, T>::value, bool>::type = true>
     std::shared_ptr<T> add_matcher(Args&&... args) {
         static_assert(std::is_base_of<pass::MatcherPass, T>::value, "pass not derived from MatcherPass");
+        auto factory = detail::make_matcher_pass_factory<T>(args...);
         auto pass = std::make_shared<T>(std::forward<Args>(args)...);
+        pass->set_factory(factory);
         auto pass_config = get_pass_config();
         pass->set_pass_config(pass_config);
         if (!Enabled && !pass_config->is_enabled<T>()) {
@@ -264,6 +326,18 @@ public:
 protected:
     bool apply_matcher_passes(std::shared_ptr<Model> f, std::deque<std::weak_ptr<Node>> nodes_to_run);
 
+    /// \brief Transforms the bodies of the sub-graph operations from the queue concurrently, each
+    /// worker thread uses own copies of the matcher passes.
+    /// \param nodes_to_run Execution queue of the model
+    /// \param transformed_nodes Sub-graph operations which bodies were transformed
+    /// \return true if any body was changed
+    bool apply_to_sub_graphs_in_parallel(const std::deque<std::weak_ptr<Node>>& nodes_to_run,
+                                         std::unordered_set<Node*>& transformed_nodes);
+
+    /// \return New GraphRewrite with the copies of the matcher passes or nullptr if any enabled
+    /// matcher pass can't be re-created
+    std::shared_ptr<GraphRewrite> clone_matchers();
+
     bool m_enable_shape_inference = false;
 
     std::vector<std::shared_ptr<ov::pass::MatcherPass>> m_matchers;
@@ -9,6 +9,7 @@
 #include <typeinfo>
 #include <vector>
 
+#include "openvino/pass/graph_rewrite.hpp"
 #include "openvino/pass/pass.hpp"
 #include "openvino/pass/validate.hpp"
 
@@ -89,7 +90,9 @@ protected:
     template <typename T, class... Args>
     std::shared_ptr<T> push_pass(Args&&... args) {
         static_assert(std::is_base_of<pass::PassBase, T>::value, "pass not derived from pass base");
+        auto factory = detail::make_matcher_pass_factory<T>(args...);
         auto pass = std::make_shared<T>(std::forward<Args>(args)...);
+        detail::set_matcher_pass_factory(pass, factory);
         auto pass_base = std::static_pointer_cast<PassBase>(pass);
         m_pass_list.push_back(pass_base);
         return pass;
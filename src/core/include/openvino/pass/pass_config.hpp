@@ -56,6 +56,8 @@ using param_callback_map = std::map<ov::DiscreteTypeInfo, param_callback>;
 /// \ingroup ov_pass_cpp_api
 class OPENVINO_API PassConfig {
 public:
+    PassConfig();
+
     /// \brief Disable transformation by its type_info
     /// \param type_info Transformation type_info
     void disable(const DiscreteTypeInfo& type_info);
@@ -156,6 +158,19 @@ public:
 
     void add_disabled_passes(const PassConfig& rhs);
 
+    /// \brief Enable or disable transformation of the independent sub-graph bodies (TensorIterator,
+    /// Loop, If etc.) by GraphRewrite in parallel threads. The bodies are transformed before the
+    /// rest of the model. Disabled by default, the default can be changed with
+    /// OV_PARALLEL_SUBGRAPH_TRANSFORMATIONS environment variable.
+    void set_parallel_sub_graphs(bool new_state) {
+        m_parallel_sub_graphs = new_state;
+    }
+
+    /// \brief Check either sub-graph bodies are transformed in parallel or not
+    bool is_parallel_sub_graphs() const {
+        return m_parallel_sub_graphs;
+    }
+
 private:
     param_callback m_callback = [](const std::shared_ptr<const ::ov::Node>&) {
         return false;
@@ -163,6 +178,7 @@ private:
     param_callback_map m_callback_map;
     std::unordered_set<DiscreteTypeInfo> m_disabled;
     std::unordered_set<DiscreteTypeInfo> m_enabled;
+    bool m_parallel_sub_graphs;
 };
 }  // namespace pass
 }  // namespace ov
@@ -10,6 +10,7 @@
 
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
@@ -70,6 +71,160 @@ inline size_t calculate_fixed_axis(size_t axis, const size_t* strides) {
         --axis;
     return axis;
 }
+
+template <typename T, typename U, typename Functor>
+void numpy_autobroadcast(const T* arg0,
+                         const T* arg1,
+                         U* out,
+                         const Shape& arg0_shape,
+                         const Shape& arg1_shape,
+                         Functor elementwise_functor) {
+    // We'll be using CoordinateTransform to handle the broadcasting. The general
+    // procedure is as follows:
+    //
+    // (1) Left pad the shorter of the two shapes with ones.
+    // (2) Squeeze (remove ones from) both shapes, and record the squeezed axis
+    //     indices.
+    // (3) Using CoordinateTransform, broadcast both args to the final output
+    //     shape. The "broadcasted axes" will be those that were squeezed in step
+    //     2.
+    //
+    // Example:
+    //
+    //    Input shape->Padded shape->Squeezed Shape/Squeezed Axes
+    //    -----------  ------------  ----------------------------
+    // a: [ 3, 2, 1]   [ 3, 2, 1]    [ 3, 2   ]     {2}
+    // b: [    1, 6]   [ 1, 1, 6]    [       6]     {0,1}
+    //                   |  |  |
+    //                   v  v  v
+    //                 Output shape
+    //                 ------------
+    //                 [ 3, 2, 6]
+    size_t const shape_rank = std::max(arg0_shape.size(), arg1_shape.size()) + 1;
+
+    // TODO: Use compiler-specific alloca() or variable-length array
+    std::vector<size_t> tmp(shape_rank * 2);
+
+    size_t* strides0 = tmp.data();
+    size_t* strides1 = tmp.data() + shape_rank;
+
+    row_major_strides(arg0_shape, strides0, shape_rank);
+    row_major_strides(arg1_shape, strides1, shape_rank);
+
+    size_t const padding0 = shape_rank - arg0_shape.size();
+    size_t const padding1 = shape_rank - arg1_shape.size();
+
+    Shape output_shape(shape_rank, 0);
+
+    size_t axis = 0;
+
+    for (size_t i = 0; i < shape_rank; i++) {
+        auto const dim0 = value_with_padding_or(arg0_shape, padding0, i, 1);
+        auto const dim1 = value_with_padding_or(arg1_shape, padding1, i, 1);
+
+        output_shape[i] = std::max(dim0, dim1);
+
+        if (dim0 != dim1)
+            axis = std::max(axis, i);
+    }
+
+    if (axis == 0) {
+        for (size_t i = 0, end = strides0[0]; i < end; ++i)
+            out[i] = elementwise_functor(arg0[i], arg1[i]);
+    } else if (strides0[axis] == 1 && value_with_padding_or(arg0_shape, padding0, axis, 1) == 1) {
+        axis = calculate_fixed_axis(axis, strides0);
+
+        numpy_autobroadcast_binop<0, 1>(arg0,
+                                        arg1,
+                                        out,
+                                        arg0_shape,
+                                        arg1_shape,
+                                        strides0,
+                                        strides1,
+                                        padding0,
+                                        padding1,
+                                        output_shape,
+                                        axis,
+                                        strides1[axis],
+                                        elementwise_functor);
+    } else if (strides1[axis] == 1 && value_with_padding_or(arg1_shape, padding1, axis, 1) == 1) {
+        axis = calculate_fixed_axis(axis, strides1);
+
+        numpy_autobroadcast_binop<1, 0>(arg0,
+                                        arg1,
+                                        out,
+                                        arg0_shape,
+                                        arg1_shape,
+                                        strides0,
+                                        strides1,
+                                        padding0,
+                                        padding1,
+                                        output_shape,
+                                        axis,
+                                        strides0[axis],
+                                        elementwise_functor);
+    } else
+        numpy_autobroadcast_binop<1, 1>(arg0,
+                                        arg1,
+                                        out,
+                                        arg0_shape,
+                                        arg1_shape,
+                                        strides0,
+                                        strides1,
+                                        padding0,
+                                        padding1,
+                                        output_shape,
+                                        axis,
+                                        strides0[axis],
+                                        elementwise_functor);
+}
+
+// Splits the output along its first axis bigger than 1 and processes the slices by several threads
+template <typename T, typename U, typename Functor>
+void parallel_numpy_autobroadcast(const T* arg0,
+                                  const T* arg1,
+                                  U* out,
+                                  const Shape& arg0_shape,
+                                  const Shape& arg1_shape,
+                                  Functor elementwise_functor) {
+    const size_t rank = std::max(arg0_shape.size(), arg1_shape.size());
+    Shape shape0(rank - arg0_shape.size(), 1);
+    shape0.insert(shape0.end(), arg0_shape.begin(), arg0_shape.end());
+    Shape shape1(rank - arg1_shape.size(), 1);
+    shape1.insert(shape1.end(), arg1_shape.begin(), arg1_shape.end());
+
+    size_t axis = 0;
+    while (axis < rank && shape0[axis] == 1 && shape1[axis] == 1)
+        ++axis;
+    size_t out_size = 1;
+    for (size_t i = 0; i < rank; i++)
+        out_size *= std::max(shape0[i], shape1[i]);
+    if (axis == rank || out_size < 2 * parallel_elementwise_grain) {
+        numpy_autobroadcast(arg0, arg1, out, arg0_shape, arg1_shape, elementwise_functor);
+        return;
+    }
+
+    const size_t axis_size = std::max(shape0[axis], shape1[axis]);
+    const size_t out_stride = out_size / axis_size;
+    const size_t stride0 = shape0[axis] == 1 ? 0 : shape_size(shape0) / axis_size;
+    const size_t stride1 = shape1[axis] == 1 ? 0 : shape_size(shape1) / axis_size;
+    parallel_for(axis_size,
+                 std::max<size_t>(1, parallel_elementwise_grain / out_stride),
+                 [&](size_t begin, size_t end) {
+                     Shape slice0(shape0.begin() + axis, shape0.end());
+                     Shape slice1(shape1.begin() + axis, shape1.end());
+                     if (stride0 != 0)
+                         slice0[0] = end - begin;
+                     if (stride1 != 0)
+                         slice1[0] = end - begin;
+                     numpy_autobroadcast(arg0 + begin * stride0,
+                                         arg1 + begin * stride1,
+                                         out + begin * out_stride,
+                                         slice0,
+                                         slice1,
+                                         elementwise_functor);
+                 });
+}
 }  // namespace internal
 
 /// \brief Helper function to implement autobroadcasting elementwise binop references.
@@ -99,113 +254,14 @@ void autobroadcast_binop(const T* arg0,
                          Functor elementwise_functor) {
     switch (broadcast_spec.m_type) {
     case op::AutoBroadcastType::NONE:
-        for (size_t i = 0; i < shape_size(arg0_shape); i++) {
-            out[i] = static_cast<U>(elementwise_functor(arg0[i], arg1[i]));
-        }
+        parallel_for(shape_size(arg0_shape), parallel_elementwise_grain, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                out[i] = static_cast<U>(elementwise_functor(arg0[i], arg1[i]));
+            }
+        });
         break;
     case op::AutoBroadcastType::NUMPY:
-        // We'll be using CoordinateTransform to handle the broadcasting. The general
-        // procedure is as follows:
-        //
-        // (1) Left pad the shorter of the two shapes with ones.
-        // (2) Squeeze (remove ones from) both shapes, and record the squeezed axis
-        //     indices.
-        // (3) Using CoordinateTransform, broadcast both args to the final output
-        //     shape. The "broadcasted axes" will be those that were squeezed in step
-        //     2.
-        //
-        // Example:
-        //
-        //    Input shape->Padded shape->Squeezed Shape/Squeezed Axes
-        //    -----------  ------------  ----------------------------
-        // a: [ 3, 2, 1]   [ 3, 2, 1]    [ 3, 2   ]     {2}
-        // b: [    1, 6]   [ 1, 1, 6]    [       6]     {0,1}
-        //                   |  |  |
-        //                   v  v  v
-        //                 Output shape
-        //                 ------------
-        //                 [ 3, 2, 6]
-        {
-            using namespace internal;
-
-            size_t const shape_rank = std::max(arg0_shape.size(), arg1_shape.size()) + 1;
-
-            // TODO: Use compiler-specific alloca() or variable-length array
-            std::vector<size_t> tmp(shape_rank * 2);
-
-            size_t* strides0 = tmp.data();
-            size_t* strides1 = tmp.data() + shape_rank;
-
-            row_major_strides(arg0_shape, strides0, shape_rank);
-            row_major_strides(arg1_shape, strides1, shape_rank);
-
-            size_t const padding0 = shape_rank - arg0_shape.size();
-            size_t const padding1 = shape_rank - arg1_shape.size();
-
-            Shape output_shape(shape_rank, 0);
-
-            size_t axis = 0;
-
-            for (size_t i = 0; i < shape_rank; i++) {
-                auto const dim0 = value_with_padding_or(arg0_shape, padding0, i, 1);
-                auto const dim1 = value_with_padding_or(arg1_shape, padding1, i, 1);
-
-                output_shape[i] = std::max(dim0, dim1);
-
-                if (dim0 != dim1)
-                    axis = std::max(axis, i);
-            }
-
-            if (axis == 0) {
-                for (size_t i = 0, end = strides0[0]; i < end; ++i)
-                    out[i] = elementwise_functor(arg0[i], arg1[i]);
-            } else if (strides0[axis] == 1 && value_with_padding_or(arg0_shape, padding0, axis, 1) == 1) {
-                axis = calculate_fixed_axis(axis, strides0);
-
-                numpy_autobroadcast_binop<0, 1>(arg0,
-                                                arg1,
-                                                out,
-                                                arg0_shape,
-                                                arg1_shape,
-                                                strides0,
-                                                strides1,
-                                                padding0,
-                                                padding1,
-                                                output_shape,
-                                                axis,
-                                                strides1[axis],
-                                                elementwise_functor);
-            } else if (strides1[axis] == 1 && value_with_padding_or(arg1_shape, padding1, axis, 1) == 1) {
-                axis = calculate_fixed_axis(axis, strides1);
-
-                numpy_autobroadcast_binop<1, 0>(arg0,
-                                                arg1,
-                                                out,
-                                                arg0_shape,
-                                                arg1_shape,
-                                                strides0,
-                                                strides1,
-                                                padding0,
-                                                padding1,
-                                                output_shape,
-                                                axis,
-                                                strides0[axis],
-                                                elementwise_functor);
-            } else
-                numpy_autobroadcast_binop<1, 1>(arg0,
-                                                arg1,
-                                                out,
-                                                arg0_shape,
-                                                arg1_shape,
-                                                strides0,
-                                                strides1,
-                                                padding0,
-                                                padding1,
-                                                output_shape,
-                                                axis,
-                                                strides0[axis],
-                                                elementwise_functor);
-        }
+        internal::parallel_numpy_autobroadcast(arg0, arg1, out, arg0_shape, arg1_shape, elementwise_functor);
         break;
     case op::AutoBroadcastType::PDPD:
         // We'll be using CoordinateTransform to handle the broadcasting. No need to
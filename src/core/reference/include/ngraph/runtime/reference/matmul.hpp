@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
 #include <utility>
@@ -11,6 +12,7 @@
 
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
@@ -35,16 +37,20 @@ void dot(const T* arg0,
     const size_t J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
     const size_t K_dim = arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
 
-    for (size_t i = 0; i < I_dim; ++i) {
-        for (size_t k = 0; k < K_dim; ++k) {
-            const size_t a_idx = i * K_dim + k;
-            for (size_t j = 0; j < J_dim; ++j) {
-                const size_t b_idx = k * J_dim + j;
-                const size_t out_idx = i * J_dim + j;
-                out[out_idx] += arg0[a_idx] * arg1[b_idx];
+    // the rows of the output are independent, every thread takes enough of them to cover the start of the thread
+    const size_t row_work = std::max<size_t>(1, K_dim * J_dim);
+    parallel_for(I_dim, std::max<size_t>(1, parallel_elementwise_grain / row_work), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            for (size_t k = 0; k < K_dim; ++k) {
+                const size_t a_idx = i * K_dim + k;
+                for (size_t j = 0; j < J_dim; ++j) {
+                    const size_t b_idx = k * J_dim + j;
+                    const size_t out_idx = i * J_dim + j;
+                    out[out_idx] += arg0[a_idx] * arg1[b_idx];
+                }
             }
         }
-    }
+    });
 }
 
 std::vector<size_t> get_transpose_order(const Shape& input_shape);
@@ -208,14 +214,19 @@ void matmul(const T* arg0,
     const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
     const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
     const size_t output_offset = shape_size(dot_output_shape);
-    for (size_t i = 0; i < output_batch_size; i++) {
-        details::dot(arg0_data + i * arg0_offset,
-                     arg1_data + i * arg1_offset,
-                     out + i * output_offset,
-                     dot_arg0_shape,
-                     dot_arg1_shape,
-                     dot_output_shape);
-    }
+    const size_t dot_work = std::max<size_t>(1, shape_size(dot_arg0_shape) * dot_output_shape.back());
+    parallel_for(output_batch_size,
+                 std::max<size_t>(1, parallel_elementwise_grain / dot_work),
+                 [&](size_t begin, size_t end) {
+                     for (size_t i = begin; i < end; i++) {
+                         details::dot(arg0_data + i * arg0_offset,
+                                      arg1_data + i * arg1_offset,
+                                      out + i * output_offset,
+                                      dot_arg0_shape,
+                                      dot_arg1_shape,
+                                      dot_output_shape);
+                     }
+                 });
 }
 }  // namespace reference
 }  // namespace runtime
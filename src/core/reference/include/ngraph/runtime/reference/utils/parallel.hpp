@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+/// \brief Enables parallel_for in the current thread while the object is alive.
+///
+/// The reference kernels are also executed at the inference stage from the threads of the plugins, where the extra
+/// parallelism oversubscribes the cores, so the kernels are parallelized only when the caller opts in (e.g. the
+/// ConstantFolding pass). The scopes can be nested.
+class ParallelScope {
+public:
+    ParallelScope();
+    ~ParallelScope();
+
+    ParallelScope(const ParallelScope&) = delete;
+    ParallelScope& operator=(const ParallelScope&) = delete;
+
+private:
+    bool m_was_enabled;
+};
+
+/// \brief Splits the range [0, work_amount) into contiguous chunks and processes them by several threads.
+///
+/// The chunks are processed by ov::parallel_nt, i.e. in the threading arena of the caller. The range is processed by
+/// the calling thread only if it contains less than two grains or if no ParallelScope is alive in this thread.
+///
+/// \param work_amount Number of the work items.
+/// \param grain_size Minimal number of the work items in one chunk, it has to cover the cost of a task start.
+/// \param body Function processing the work items [begin, end), has to be safe to call from several threads.
+void parallel_for(size_t work_amount, size_t grain_size, const std::function<void(size_t, size_t)>& body);
+
+/// \brief Default minimal number of the elements processed by one thread in the elementwise kernels.
+constexpr size_t parallel_elementwise_grain = 64 * 1024;
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
@@ -9,6 +9,7 @@
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 using namespace ngraph;
 
@@ -200,6 +201,89 @@ void reshape_in6(const char* in,
         }
     }
 }
+template <typename T>
+void copy_strided_row(const char* in, char* out, size_t count, size_t in_stride) {
+    auto src = reinterpret_cast<const T*>(in);
+    auto dst = reinterpret_cast<T*>(out);
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = src[i * in_stride];
+    }
+}
+
+// Generic transposition of the big tensors. The output rows are distributed between the threads, every row is
+// gathered from the input with a constant stride.
+void reshape_parallel(const char* in,
+                      char* out,
+                      const Shape& in_shape,
+                      const AxisVector& in_axis_order,
+                      size_t elem_size) {
+    const size_t rank = in_shape.size();
+    std::vector<size_t> in_strides(rank, 1);
+    for (size_t i = rank - 1; i > 0; --i) {
+        in_strides[i - 1] = in_strides[i] * in_shape[i];
+    }
+    std::vector<size_t> out_dims(rank), src_strides(rank);
+    for (size_t i = 0; i < rank; ++i) {
+        out_dims[i] = in_shape[in_axis_order[i]];
+        src_strides[i] = in_strides[in_axis_order[i]];
+    }
+    const size_t row_size = out_dims[rank - 1];
+    const size_t row_stride = src_strides[rank - 1];
+    const size_t rows = shape_size(in_shape) / row_size;
+
+    auto copy_row = [&](const char* src, char* dst) {
+        switch (elem_size) {
+        case 1:
+            copy_strided_row<uint8_t>(src, dst, row_size, row_stride);
+            break;
+        case 2:
+            copy_strided_row<uint16_t>(src, dst, row_size, row_stride);
+            break;
+        case 4:
+            copy_strided_row<uint32_t>(src, dst, row_size, row_stride);
+            break;
+        case 8:
+            copy_strided_row<uint64_t>(src, dst, row_size, row_stride);
+            break;
+        default:
+            for (size_t i = 0; i < row_size; ++i) {
+                std::memcpy(dst + i * elem_size, src + i * row_stride * elem_size, elem_size);
+            }
+        }
+    };
+
+    runtime::reference::parallel_for(
+        rows,
+        std::max<size_t>(1, runtime::reference::parallel_elementwise_grain / row_size),
+        [&](size_t begin, size_t end) {
+            // coordinates of the row in the output and offset of its first element in the input
+            std::vector<size_t> coord(rank - 1);
+            size_t in_offset = 0;
+            for (size_t i = rank - 1, row = begin; i > 0; --i) {
+                coord[i - 1] = row % out_dims[i - 1];
+                row /= out_dims[i - 1];
+                in_offset += coord[i - 1] * src_strides[i - 1];
+            }
+            for (size_t row = begin; row < end; ++row) {
+                const char* src = in + in_offset * elem_size;
+                char* dst = out + row * row_size * elem_size;
+                if (row_stride == 1) {
+                    std::memcpy(dst, src, row_size * elem_size);
+                } else {
+                    copy_row(src, dst);
+                }
+                for (size_t i = rank - 1; i > 0; --i) {
+                    in_offset += src_strides[i - 1];
+                    if (++coord[i - 1] < out_dims[i - 1]) {
+                        break;
+                    }
+                    in_offset -= coord[i - 1] * src_strides[i - 1];
+                    coord[i - 1] = 0;
+                }
+            }
+        });
+}
+
 bool no_axis_reordering(const AxisVector& axis_order) {
     auto tmp = axis_order;
     std::sort(begin(tmp), end(tmp));
@@ -217,6 +301,10 @@ void runtime::opt_kernel::reshape(const char* in,
         std::memcpy(out, in, shape_size(in_shape) * elem_size);
         return;
     }
+    if (in_shape.size() > 1 && shape_size(in_shape) >= 2 * runtime::reference::parallel_elementwise_grain) {
+        reshape_parallel(in, out, in_shape, in_axis_order, elem_size);
+        return;
+    }
 
     switch (in_shape.size()) {
     case 0:
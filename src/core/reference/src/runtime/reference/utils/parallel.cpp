@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+namespace {
+// Set by ParallelScope, the kernels called without it are executed sequentially
+thread_local bool parallel_enabled = false;
+}  // namespace
+
+ParallelScope::ParallelScope() : m_was_enabled(parallel_enabled) {
+    parallel_enabled = true;
+}
+
+ParallelScope::~ParallelScope() {
+    parallel_enabled = m_was_enabled;
+}
+
+void parallel_for(size_t work_amount, size_t grain_size, const std::function<void(size_t, size_t)>& body) {
+    if (work_amount == 0) {
+        return;
+    }
+    size_t nthr = parallel_enabled ? static_cast<size_t>(std::max(1, parallel_get_max_threads())) : 1;
+    nthr = std::min(nthr, work_amount / std::max<size_t>(grain_size, 1));
+    if (nthr <= 1) {
+        body(0, work_amount);
+        return;
+    }
+
+    // the exceptions must not leave the parallel region, they are rethrown in the calling thread
+    std::vector<std::exception_ptr> errors(nthr);
+    ov::parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int team) {
+        size_t begin = 0, end = 0;
+        ov::splitter(work_amount, static_cast<size_t>(team), static_cast<size_t>(ithr), begin, end);
+        try {
+            body(begin, end);
+        } catch (...) {
+            errors[ithr] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
@@ -0,0 +1,193 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/compile_profiler.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "openvino/util/common_util.hpp"
+#include "openvino/util/env_util.hpp"
+
+#ifndef _WIN32
+#    include <sys/resource.h>
+#endif
+
+namespace {
+// Nesting level of the active scopes of the current thread
+thread_local size_t scope_depth = 0;
+
+int64_t get_peak_rss_kb() {
+#ifndef _WIN32
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#    ifdef __APPLE__
+    // reported in bytes on macOS and in kilobytes on Linux
+    return static_cast<int64_t>(usage.ru_maxrss) / 1024;
+#    else
+    return static_cast<int64_t>(usage.ru_maxrss);
+#    endif
+#else
+    return 0;
+#endif
+}
+
+std::string escape_json(const std::string& str) {
+    std::ostringstream result;
+    for (const auto c : str) {
+        switch (c) {
+        case '"':
+            result << "\\\"";
+            break;
+        case '\\':
+            result << "\\\\";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                result << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+            } else {
+                result << c;
+            }
+        }
+    }
+    return result.str();
+}
+
+std::string escape_csv(const std::string& str) {
+    if (str.find_first_of(",\"\n") == std::string::npos)
+        return str;
+    std::string result = "\"";
+    for (const auto c : str) {
+        if (c == '"')
+            result += '"';
+        result += c;
+    }
+    return result + "\"";
+}
+}  // namespace
+
+ov::CompileProfiler::Scope::~Scope() {
+    if (!m_active)
+        return;
+    scope_depth--;
+
+    Record record;
+    record.time_ms =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+    record.category = std::move(m_category);
+    record.name = std::move(m_name);
+    record.depth = m_depth;
+    record.nodes_before = m_nodes_before;
+    record.nodes_after = m_count_nodes ? m_count_nodes() : 0;
+    record.peak_rss_delta_kb = get_peak_rss_kb() - m_peak_rss_before;
+    CompileProfiler::get().add_record(std::move(record));
+}
+
+void ov::CompileProfiler::Scope::start(std::string category, std::string name, std::function<size_t()> count_nodes) {
+    if (m_active || !CompileProfiler::get().is_enabled())
+        return;
+    m_active = true;
+    m_category = std::move(category);
+    m_name = std::move(name);
+    m_count_nodes = std::move(count_nodes);
+    m_depth = scope_depth++;
+    m_nodes_before = m_count_nodes ? m_count_nodes() : 0;
+    m_peak_rss_before = get_peak_rss_kb();
+    m_start = std::chrono::steady_clock::now();
+}
+
+void ov::CompileProfiler::Scope::discard() {
+    if (!m_active)
+        return;
+    scope_depth--;
+    m_active = false;
+}
+
+ov::CompileProfiler& ov::CompileProfiler::get() {
+    static CompileProfiler profiler;
+    return profiler;
+}
+
+ov::CompileProfiler::CompileProfiler() {
+    const auto path = ov::util::getenv_string("OV_COMPILE_PROFILE");
+    if (!path.empty())
+        enable(path);
+}
+
+ov::CompileProfiler::~CompileProfiler() {
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        path = m_path;
+    }
+    if (path.empty())
+        return;
+    try {
+        dump(path);
+    } catch (...) {
+    }
+}
+
+void ov::CompileProfiler::enable(const std::string& path) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_path = path;
+    m_enabled = true;
+}
+
+void ov::CompileProfiler::disable() {
+    m_enabled = false;
+}
+
+void ov::CompileProfiler::add_record(Record record) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_records.push_back(std::move(record));
+}
+
+std::vector<ov::CompileProfiler::Record> ov::CompileProfiler::get_records() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_records;
+}
+
+void ov::CompileProfiler::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_records.clear();
+}
+
+void ov::CompileProfiler::dump_json(std::ostream& stream) const {
+    const auto records = get_records();
+    stream << "[\n";
+    for (size_t i = 0; i < records.size(); ++i) {
+        const auto& record = records[i];
+        stream << "  {\"category\": \"" << escape_json(record.category) << "\", \"name\": \""
+               << escape_json(record.name) << "\", \"depth\": " << record.depth << ", \"time_ms\": " << std::fixed
+               << std::setprecision(3) << record.time_ms << ", \"nodes_before\": " << record.nodes_before
+               << ", \"nodes_after\": " << record.nodes_after
+               << ", \"peak_rss_delta_kb\": " << record.peak_rss_delta_kb << "}"
+               << (i + 1 < records.size() ? ",\n" : "\n");
+    }
+    stream << "]\n";
+}
+
+void ov::CompileProfiler::dump_csv(std::ostream& stream) const {
+    const auto records = get_records();
+    stream << "category,name,depth,time_ms,nodes_before,nodes_after,peak_rss_delta_kb\n";
+    for (const auto& record : records) {
+        stream << escape_csv(record.category) << "," << escape_csv(record.name) << "," << record.depth << ","
+               << std::fixed << std::setprecision(3) << record.time_ms << "," << record.nodes_before << ","
+               << record.nodes_after << "," << record.peak_rss_delta_kb << "\n";
+    }
+}
+
+void ov::CompileProfiler::dump(const std::string& path) const {
+    std::ofstream stream(path);
+    if (!stream.is_open())
+        return;
+    if (ov::util::ends_with(path, ".csv")) {
+        dump_csv(stream);
+    } else {
+        dump_json(stream);
+    }
+}
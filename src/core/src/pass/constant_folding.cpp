@@ -4,8 +4,15 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <cstring>
+#include <iomanip>
+#include <limits>
 #include <openvino/cc/pass/itt.hpp>
+#include <sstream>
+#include <unordered_map>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+#include "openvino/core/attribute_visitor.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/constant.hpp"
@@ -13,6 +20,7 @@
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/shape_of_base.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
+#include "openvino/pass/constant_folding_cache.hpp"
 
 using namespace std;
 
@@ -51,11 +59,244 @@ const auto friendly_name_from = [](const ov::Node& node, const size_t output_cou
     }
 };
 
+namespace {
+// Results smaller than this are cheaper to fold again than to look up in the cache
+constexpr size_t min_cached_result_size = 4096;
+
+uint64_t hash_data(const void* data, size_t size) {
+    // FNV-1a over 64-bit words with an extra shift to mix the high bits down, the hash has to be the same in all the
+    // processes sharing the cache directory
+    const auto bytes = static_cast<const char*>(data);
+    uint64_t hash = 0xcbf29ce484222325ull ^ size;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * 0x100000001b3ull;
+        hash ^= hash >> 29;
+    }
+    for (; i < size; i++) {
+        hash = (hash ^ static_cast<uint8_t>(bytes[i])) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+/**
+ * \brief Writes the attributes of a node to the folding cache key.
+ *
+ * The attributes of the types which can't be written (e.g. bodies of sub-graph operations) make the key invalid.
+ */
+class FoldingKeyVisitor : public ov::AttributeVisitor {
+public:
+    explicit FoldingKeyVisitor(std::ostream& stream) : m_stream(stream) {
+        m_stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+    }
+
+    bool is_valid() const {
+        return m_valid;
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        m_valid = false;
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<void*>& adapter) override {
+        m_valid = false;
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        m_valid = false;
+    }
+    void on_adapter(const std::string& name, ov::VisitorAdapter& adapter) override {
+        adapter.visit_attributes(*this);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        // the size is written to separate the strings from the following attributes
+        m_stream << name << "=" << adapter.get().size() << ":" << adapter.get() << ";";
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int8_t>& adapter) override {
+        write(name, static_cast<int64_t>(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int16_t>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int32_t>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint8_t>& adapter) override {
+        write(name, static_cast<uint64_t>(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint16_t>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint32_t>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint64_t>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<float>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        write(name, std::vector<int64_t>(adapter.get().begin(), adapter.get().end()));
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        write(name, std::vector<uint64_t>(adapter.get().begin(), adapter.get().end()));
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<double>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        m_stream << name << "=[";
+        for (const auto& value : adapter.get())
+            m_stream << value.size() << ":" << value << ",";
+        m_stream << "];";
+    }
+
+private:
+    template <typename T>
+    void write(const std::string& name, const T& value) {
+        m_stream << name << "=" << value << ";";
+    }
+
+    template <typename T>
+    void write(const std::string& name, const std::vector<T>& values) {
+        m_stream << name << "=[";
+        for (const auto& value : values)
+            m_stream << value << ",";
+        m_stream << "];";
+    }
+
+    std::ostream& m_stream;
+    bool m_valid = true;
+};
+
+/**
+ * \brief Identities of the constants used in the folding cache keys.
+ *
+ * The identity of a folded constant is the hash of the key it was folded or found by, the identity of the other
+ * constants is the hash of their data. The nodes aren't kept alive, an identity is dropped if its node is destroyed.
+ */
+class ConstantIdentities {
+public:
+    uint64_t get(const std::shared_ptr<ov::op::v0::Constant>& constant) {
+        auto found = m_identities.find(constant.get());
+        if (found != m_identities.end() && found->second.first.lock() == constant)
+            return found->second.second;
+        const auto identity = hash_data(constant->get_data_ptr(), constant->get_byte_size());
+        set(constant, identity);
+        return identity;
+    }
+
+    void set(const std::shared_ptr<ov::Node>& constant, uint64_t identity) {
+        m_identities[constant.get()] = {constant, identity};
+    }
+
+private:
+    std::unordered_map<const ov::Node*, std::pair<std::weak_ptr<ov::Node>, uint64_t>> m_identities;
+};
+
+/**
+ * \brief Builds the folding cache key of the node.
+ *
+ * \return Empty string if the node result can't be cached: the folding is disabled, not all the inputs are constants,
+ * the outputs are dynamic or small, the node isn't from the standard opsets or it has attributes which can't be
+ * written.
+ */
+std::string get_folding_cache_key(const std::shared_ptr<ov::Node>& node, ConstantIdentities& identities) {
+    if (ov::pass::constant_folding_is_disabled(node) || ov::is_type<ov::op::v0::Constant>(node) ||
+        ov::is_type<ov::op::util::MultiSubGraphOp>(node) || node->get_input_size() == 0)
+        return {};
+    // the attributes of the custom operations may be visited partially, so the different nodes could get the same key
+    const auto& type_info = node->get_type_info();
+    if (!type_info.version_id || std::strncmp(type_info.version_id, "opset", 5) != 0)
+        return {};
+
+    size_t result_size = 0;
+    for (const auto& output : node->outputs()) {
+        if (output.get_partial_shape().is_dynamic() || output.get_element_type().is_dynamic())
+            return {};
+        result_size += ov::shape_size(output.get_shape()) * output.get_element_type().size();
+    }
+    if (result_size < min_cached_result_size)
+        return {};
+
+    std::stringstream key;
+    key << type_info.name << "/" << type_info.version_id << "|";
+    for (const auto& input : node->input_values()) {
+        const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(input.get_node_shared_ptr());
+        if (!constant)
+            return {};
+        key << input.get_element_type() << input.get_shape() << "#" << std::hex << identities.get(constant)
+            << std::dec << ",";
+    }
+    key << "|";
+    for (const auto& output : node->outputs())
+        key << output.get_element_type() << output.get_shape() << ",";
+    key << "|";
+    FoldingKeyVisitor visitor(key);
+    if (!node->visit_attributes(visitor) || !visitor.is_valid())
+        return {};
+    return key.str();
+}
+
+// The results which share the data with the inputs (e.g. Reshape) aren't cached, they are cheap to fold and the cache
+// would keep the input data alive
+bool is_cacheable_result(const std::shared_ptr<ov::Node>& node, const ov::OutputVector& replacements) {
+    for (const auto& replacement : replacements) {
+        const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(replacement.get_node_shared_ptr());
+        if (!constant || replacement.get_index() != 0)
+            return false;
+        for (const auto& input : node->input_values()) {
+            const auto input_constant = ov::as_type_ptr<ov::op::v0::Constant>(input.get_node_shared_ptr());
+            if (input_constant && input_constant->get_data_ptr() == constant->get_data_ptr())
+                return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
+    // the transformations are executed at the compilation stage, so the reference kernels may use all the threads
+    ngraph::runtime::reference::ParallelScope parallel_kernels;
 
     bool rewritten = pre_calculated_values_folding(model);
 
+    auto& cache = ConstantFoldingCache::get();
+    const bool use_cache = cache.is_enabled();
+    ConstantIdentities identities;
+
     for (const auto& node : model->get_ordered_ops()) {
         if (rewritten) {
             node->validate_and_infer_types();
@@ -63,7 +304,28 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
 
         OutputVector replacements(node->get_output_size());
 
-        if (node->constant_fold(replacements, node->input_values())) {
+        const auto cache_key = use_cache ? get_folding_cache_key(node, identities) : std::string{};
+        ConstantFoldingCache::Outputs cached;
+        bool folded = false;
+        if (!cache_key.empty() && cache.lookup(cache_key, cached) && cached.size() == replacements.size()) {
+            std::copy(cached.begin(), cached.end(), replacements.begin());
+            folded = true;
+        } else {
+            folded = node->constant_fold(replacements, node->input_values());
+            if (folded && !cache_key.empty() && is_cacheable_result(node, replacements)) {
+                cached.clear();
+                for (const auto& replacement : replacements)
+                    cached.push_back(ov::as_type_ptr<op::v0::Constant>(replacement.get_node_shared_ptr()));
+                cache.store(cache_key, cached);
+            }
+        }
+        if (folded && !cache_key.empty()) {
+            const auto key_hash = hash_data(cache_key.data(), cache_key.size());
+            for (size_t i = 0; i < replacements.size(); ++i)
+                identities.set(replacements[i].get_node_shared_ptr(), key_hash + i);
+        }
+
+        if (folded) {
             OPENVINO_ASSERT(!constant_folding_is_disabled(node),
                             "Node folded but constant folding disabled. Check constant_fold implementation for ",
                             node);
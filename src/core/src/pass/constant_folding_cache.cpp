@@ -0,0 +1,338 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/pass/constant_folding_cache.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#ifdef _WIN32
+#    include <process.h>
+#else
+#    include <unistd.h>
+#endif
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/core/version.hpp"
+#include "openvino/util/env_util.hpp"
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace {
+// The file layout:
+// | magic | version | build number size | build number | key size | key | outputs count | per output: type name size, type name, rank, dims,
+// | data offset, data size | padding | data of the outputs aligned to data_alignment |
+constexpr char file_magic[4] = {'O', 'V', 'C', 'F'};
+constexpr uint64_t file_version = 2;
+constexpr size_t data_alignment = 64;
+constexpr size_t default_capacity = 512 * 1024 * 1024;
+
+// The folding results may differ between the builds, the files written by the other builds are ignored
+const std::string& get_build_number() {
+    static const std::string build_number = ov::get_openvino_version().buildNumber;
+    return build_number;
+}
+
+int get_process_id() {
+#ifdef _WIN32
+    return _getpid();
+#else
+    return getpid();
+#endif
+}
+
+uint64_t hash_key(const std::string& key) {
+    // FNV-1a, the file names have to be the same in all the processes
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (const auto c : key) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+void write_u64(std::string& buffer, uint64_t value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void write_string(std::string& buffer, const std::string& value) {
+    write_u64(buffer, value.size());
+    buffer.append(value);
+}
+
+class Reader {
+public:
+    Reader(const char* data, size_t size) : m_data(data), m_size(size) {}
+
+    bool read_u64(uint64_t& value) {
+        if (m_size - m_pos < sizeof(value))
+            return false;
+        std::memcpy(&value, m_data + m_pos, sizeof(value));
+        m_pos += sizeof(value);
+        return true;
+    }
+
+    bool read_string(std::string& value) {
+        uint64_t size = 0;
+        if (!read_u64(size) || m_size - m_pos < size)
+            return false;
+        value.assign(m_data + m_pos, size);
+        m_pos += size;
+        return true;
+    }
+
+    bool read_magic() {
+        if (m_size - m_pos < sizeof(file_magic) || std::memcmp(m_data + m_pos, file_magic, sizeof(file_magic)) != 0)
+            return false;
+        m_pos += sizeof(file_magic);
+        return true;
+    }
+
+private:
+    const char* m_data;
+    size_t m_size;
+    size_t m_pos = 0;
+};
+
+size_t get_outputs_size(const ov::pass::ConstantFoldingCache::Outputs& outputs) {
+    size_t size = 0;
+    for (const auto& output : outputs)
+        size += output->get_byte_size();
+    return size;
+}
+
+ov::pass::ConstantFoldingCache::Outputs share_outputs(const ov::pass::ConstantFoldingCache::Outputs& outputs) {
+    ov::pass::ConstantFoldingCache::Outputs result;
+    result.reserve(outputs.size());
+    for (const auto& output : outputs)
+        result.push_back(std::make_shared<ov::op::v0::Constant>(*output));
+    return result;
+}
+
+bool load_outputs(const std::string& path, const std::string& key, ov::pass::ConstantFoldingCache::Outputs& outputs) {
+    if (!ov::util::file_exists(path))
+        return false;
+    std::shared_ptr<ov::MappedMemory> mapped_memory;
+    try {
+        mapped_memory = ov::load_mmap_object(path);
+    } catch (const std::exception&) {
+        return false;
+    }
+
+    Reader reader(mapped_memory->data(), mapped_memory->size());
+    uint64_t version = 0, outputs_count = 0;
+    std::string build_number, file_key;
+    if (!reader.read_magic() || !reader.read_u64(version) || version != file_version ||
+        !reader.read_string(build_number) || build_number != get_build_number() || !reader.read_string(file_key) ||
+        file_key != key || !reader.read_u64(outputs_count))
+        return false;
+
+    ov::pass::ConstantFoldingCache::Outputs result;
+    for (uint64_t i = 0; i < outputs_count; i++) {
+        std::string type_name;
+        uint64_t rank = 0, offset = 0, size = 0;
+        if (!reader.read_string(type_name) || !reader.read_u64(rank))
+            return false;
+        ov::Shape shape(rank);
+        for (auto& dim : shape) {
+            uint64_t value = 0;
+            if (!reader.read_u64(value))
+                return false;
+            dim = static_cast<size_t>(value);
+        }
+        if (!reader.read_u64(offset) || !reader.read_u64(size) || offset > mapped_memory->size() ||
+            size > mapped_memory->size() - offset)
+            return false;
+
+        const ov::element::Type type(type_name);
+        if (size != (ov::shape_size(shape) * type.bitwidth() + 7) / 8)
+            return false;
+        auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+            mapped_memory->data() + offset,
+            size,
+            mapped_memory);
+        result.push_back(std::make_shared<ov::op::v0::Constant>(type, shape, buffer));
+    }
+    outputs = std::move(result);
+    return true;
+}
+
+void save_outputs(const std::string& path,
+                  const std::string& key,
+                  const ov::pass::ConstantFoldingCache::Outputs& outputs) {
+    std::string header(file_magic, sizeof(file_magic));
+    write_u64(header, file_version);
+    write_string(header, get_build_number());
+    write_string(header, key);
+    write_u64(header, outputs.size());
+
+    // the header size doesn't depend on the offsets, so it is calculated with the zero ones first
+    std::vector<size_t> offset_positions;
+    for (const auto& output : outputs) {
+        write_string(header, output->get_element_type().get_type_name());
+        write_u64(header, output->get_shape().size());
+        for (const auto dim : output->get_shape())
+            write_u64(header, dim);
+        offset_positions.push_back(header.size());
+        write_u64(header, 0);
+        write_u64(header, output->get_byte_size());
+    }
+    size_t offset = (header.size() + data_alignment - 1) / data_alignment * data_alignment;
+    std::vector<size_t> offsets;
+    for (size_t i = 0; i < outputs.size(); i++) {
+        const uint64_t value = offset;
+        std::memcpy(&header[offset_positions[i]], &value, sizeof(value));
+        offsets.push_back(offset);
+        offset = (offset + outputs[i]->get_byte_size() + data_alignment - 1) / data_alignment * data_alignment;
+    }
+
+    // the file is written under a temporary name and renamed, so the other processes never see a partial file;
+    // the name is unique for the process and the store call, the same result may be stored by several threads
+    static std::atomic<uint64_t> temp_counter{0};
+    std::stringstream temp_suffix;
+    temp_suffix << ".tmp" << get_process_id() << "_" << temp_counter++;
+    const auto temp_path = path + temp_suffix.str();
+    {
+        std::ofstream stream(temp_path, std::ios::binary);
+        if (!stream.is_open())
+            return;
+        stream.write(header.data(), header.size());
+        size_t position = header.size();
+        for (size_t i = 0; i < outputs.size(); i++) {
+            const std::string padding(offsets[i] - position, '\0');
+            stream.write(padding.data(), padding.size());
+            stream.write(static_cast<const char*>(outputs[i]->get_data_ptr()), outputs[i]->get_byte_size());
+            position = offsets[i] + outputs[i]->get_byte_size();
+        }
+        if (!stream.good()) {
+            stream.close();
+            std::remove(temp_path.c_str());
+            return;
+        }
+    }
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0)
+        std::remove(temp_path.c_str());
+}
+}  // namespace
+
+ov::pass::ConstantFoldingCache& ov::pass::ConstantFoldingCache::get() {
+    static ConstantFoldingCache cache;
+    return cache;
+}
+
+ov::pass::ConstantFoldingCache::ConstantFoldingCache() : m_capacity(default_capacity) {
+    const auto cache_dir = ov::util::getenv_string("OV_CONSTANT_FOLDING_CACHE_DIR");
+    if (!cache_dir.empty() || ov::util::getenv_bool("OV_CONSTANT_FOLDING_CACHE"))
+        enable(cache_dir);
+}
+
+void ov::pass::ConstantFoldingCache::enable(const std::string& cache_dir) {
+    if (!cache_dir.empty())
+        ov::util::create_directory_recursive(cache_dir);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cache_dir = cache_dir;
+    m_enabled = true;
+}
+
+void ov::pass::ConstantFoldingCache::disable() {
+    m_enabled = false;
+}
+
+void ov::pass::ConstantFoldingCache::set_capacity(size_t bytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = bytes;
+    while (m_size > m_capacity && !m_entries.empty()) {
+        m_size -= m_entries.back().size;
+        m_index.erase(m_entries.back().key);
+        m_entries.pop_back();
+    }
+}
+
+bool ov::pass::ConstantFoldingCache::lookup(const std::string& key, Outputs& outputs) {
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto found = m_index.find(key);
+        if (found != m_index.end()) {
+            m_entries.splice(m_entries.begin(), m_entries, found->second);
+            outputs = share_outputs(found->second->outputs);
+            m_hits++;
+            return true;
+        }
+        path = get_file_path(key);
+    }
+
+    Outputs loaded;
+    bool is_loaded = false;
+    if (!path.empty()) {
+        try {
+            is_loaded = load_outputs(path, key, loaded);
+        } catch (const std::exception&) {
+            // a broken file is a miss, it is overwritten by the next store
+        }
+    }
+    if (is_loaded) {
+        add_entry(key, loaded);
+        outputs = share_outputs(loaded);
+        m_hits++;
+        return true;
+    }
+    m_misses++;
+    return false;
+}
+
+void ov::pass::ConstantFoldingCache::store(const std::string& key, const Outputs& outputs) {
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_index.count(key))
+            return;
+        path = get_file_path(key);
+    }
+    // the cache keeps its own constants, so the friendly names and rt_info of the model nodes aren't shared
+    const auto cached = share_outputs(outputs);
+    add_entry(key, cached);
+    if (!path.empty())
+        save_outputs(path, key, cached);
+}
+
+void ov::pass::ConstantFoldingCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_index.clear();
+    m_size = 0;
+}
+
+size_t ov::pass::ConstantFoldingCache::get_size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_size;
+}
+
+void ov::pass::ConstantFoldingCache::add_entry(const std::string& key, const Outputs& outputs) {
+    const auto size = get_outputs_size(outputs);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (size > m_capacity || m_index.count(key))
+        return;
+    m_entries.push_front(Entry{key, outputs, size});
+    m_index[key] = m_entries.begin();
+    m_size += size;
+    while (m_size > m_capacity) {
+        m_size -= m_entries.back().size;
+        m_index.erase(m_entries.back().key);
+        m_entries.pop_back();
+    }
+}
+
+std::string ov::pass::ConstantFoldingCache::get_file_path(const std::string& key) const {
+    if (m_cache_dir.empty())
+        return {};
+    std::stringstream name;
+    // the build number is a part of the name, so the different builds sharing the directory don't overwrite the files
+    name << std::hex << std::setw(16) << std::setfill('0') << hash_key(get_build_number() + '\n' + key) << ".ovcf";
+    return ov::util::path_join({m_cache_dir, name.str()});
+}
@@ -5,7 +5,9 @@
 #include "ngraph/pass/graph_rewrite.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
+#include <exception>
 #include <iostream>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <openvino/cc/pass/itt.hpp>
@@ -17,6 +19,7 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/util/log.hpp"
 #include "perf_counters.hpp"
 
@@ -67,6 +70,11 @@ PerfCounters& perf_counters_graph_rewrite() {
 
 #endif  // ENABLE_PROFILING_ITT
 
+namespace {
+// Is set in the threads transforming the sub-graph bodies, so the nested bodies are transformed serially
+thread_local bool in_parallel_sub_graphs = false;
+}  // namespace
+
 bool ov::pass::BackwardGraphRewrite::run_on_model(const std::shared_ptr<ov::Model>& f) {
     RUN_ON_MODEL_SCOPE(BackwardGraphRewrite);
     // Initialize execution queue with nodes in topological order
@@ -171,6 +179,11 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     // list of matchers to run for a node; define here to keep memory allocated
     std::vector<size_t> matcher_passes_to_run;
 
+    std::unordered_set<Node*> transformed_sub_graphs;
+    if (pass_config->is_parallel_sub_graphs() && !in_parallel_sub_graphs) {
+        rewritten = apply_to_sub_graphs_in_parallel(nodes_to_run, transformed_sub_graphs);
+    }
+
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -181,7 +194,7 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // Recursive apply Matchers for sub-graph based nodes
         if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
-            if (sub_graph_node->get_transformations_allowed()) {
+            if (sub_graph_node->get_transformations_allowed() && !transformed_sub_graphs.count(node.get())) {
                 size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
                 for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
                     auto sub_graph = sub_graph_node->get_function(sub_graph_ind);
@@ -240,6 +253,95 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     return rewritten;
 }
 
+bool ov::pass::GraphRewrite::apply_to_sub_graphs_in_parallel(const std::deque<std::weak_ptr<Node>>& nodes_to_run,
+                                                             std::unordered_set<Node*>& transformed_nodes) {
+    std::vector<std::shared_ptr<ngraph::op::util::MultiSubGraphOp>> sub_graph_nodes;
+    std::vector<std::shared_ptr<Model>> sub_graphs;
+    std::unordered_set<Model*> unique_sub_graphs;
+    for (const auto& weak_node : nodes_to_run) {
+        auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(weak_node.lock());
+        if (!sub_graph_node || !sub_graph_node->get_transformations_allowed())
+            continue;
+        for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graph_node->get_internal_subgraphs_size(); ++sub_graph_ind) {
+            auto sub_graph = sub_graph_node->get_function(sub_graph_ind);
+            if (sub_graph && unique_sub_graphs.insert(sub_graph.get()).second)
+                sub_graphs.push_back(sub_graph);
+        }
+        sub_graph_nodes.push_back(sub_graph_node);
+    }
+    if (sub_graphs.size() < 2)
+        return false;
+
+    OV_ITT_SCOPED_TASK(ov::itt::domains::core, "pass::GraphRewrite::apply_to_sub_graphs_in_parallel");
+
+    // MatcherPass keeps the state of the current match, so every thread needs own copies of the passes
+    const size_t threads_num =
+        std::min(sub_graphs.size(), static_cast<size_t>(std::max(1, parallel_get_max_threads())));
+    if (threads_num < 2)
+        return false;
+    std::vector<std::shared_ptr<GraphRewrite>> rewrites;
+    for (size_t thread_ind = 0; thread_ind < threads_num; ++thread_ind) {
+        auto rewrite = clone_matchers();
+        if (!rewrite) {
+            OPENVINO_DEBUG << "GraphRewrite " << get_name()
+                           << " can't re-create matcher passes, sub-graphs are transformed serially";
+            return false;
+        }
+        rewrites.push_back(rewrite);
+    }
+
+    // the sub-graphs are transformed in the caller's threading arena, the threads take them one by one
+    std::atomic<size_t> next_sub_graph(0);
+    std::vector<char> sub_graph_rewritten(sub_graphs.size(), 0);
+    std::vector<std::exception_ptr> errors(threads_num);
+    ov::parallel_nt(static_cast<int>(threads_num), [&](const int thread_ind, const int) {
+        const bool was_in_parallel_sub_graphs = in_parallel_sub_graphs;
+        in_parallel_sub_graphs = true;
+        try {
+            for (size_t ind = next_sub_graph++; ind < sub_graphs.size(); ind = next_sub_graph++) {
+                sub_graph_rewritten[ind] = rewrites[thread_ind]->run_on_model(sub_graphs[ind]);
+            }
+        } catch (...) {
+            errors[thread_ind] = std::current_exception();
+        }
+        in_parallel_sub_graphs = was_in_parallel_sub_graphs;
+    });
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    for (const auto& sub_graph_node : sub_graph_nodes) {
+        transformed_nodes.insert(sub_graph_node.get());
+    }
+    return std::any_of(sub_graph_rewritten.begin(), sub_graph_rewritten.end(), [](char rewritten) {
+        return rewritten != 0;
+    });
+}
+
+std::shared_ptr<ov::pass::GraphRewrite> ov::pass::GraphRewrite::clone_matchers() {
+    std::shared_ptr<GraphRewrite> rewrite;
+    if (dynamic_cast<BackwardGraphRewrite*>(this)) {
+        rewrite = std::make_shared<BackwardGraphRewrite>();
+    } else {
+        rewrite = std::make_shared<GraphRewrite>();
+    }
+    rewrite->set_name(get_name());
+    rewrite->m_enable_shape_inference = m_enable_shape_inference;
+
+    const auto& pass_config = get_pass_config();
+    for (const auto& matcher : m_matchers) {
+        if (pass_config->is_disabled(matcher->get_type_info()))
+            continue;
+        auto matcher_copy = matcher->clone();
+        if (!matcher_copy)
+            return nullptr;
+        rewrite->m_matchers.push_back(matcher_copy);
+    }
+    rewrite->set_pass_config(pass_config);
+    return rewrite;
+}
+
 void ov::pass::GraphRewrite::set_pass_config(const std::shared_ptr<PassConfig>& rhs) {
     auto pass_config = get_pass_config();
     // We have to preserve disabled passes because in case when we register matchers inside
@@ -293,6 +395,15 @@ void ov::pass::MatcherPass::register_matcher(const std::shared_ptr<ov::pass::pat
     register_matcher(m, callback, PassProperty::CHANGE_DYNAMIC_STATE);
 }
 
+std::shared_ptr<ov::pass::MatcherPass> ov::pass::MatcherPass::clone() {
+    if (!m_factory)
+        return nullptr;
+    auto pass = m_factory();
+    pass->m_factory = m_factory;
+    pass->set_pass_config(get_pass_config());
+    return pass;
+}
+
 bool ov::pass::MatcherPass::apply(std::shared_ptr<ov::Node> node) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, pass::perf_counters_graph_rewrite()[get_type_info()]);
     clear_new_nodes();
@@ -20,6 +20,7 @@
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/util.hpp"
+#include "openvino/core/compile_profiler.hpp"
 #include "openvino/util/env_util.hpp"
 #include "openvino/util/log.hpp"
 #include "perf_counters.hpp"
@@ -82,6 +83,13 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
 
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ov_pass, ov::pass::perf_counters()[pass->get_type_info()]);
 
+        ov::CompileProfiler::Scope profile_scope;
+        if (ov::CompileProfiler::get().is_enabled()) {
+            profile_scope.start("pass", pass->get_name(), [&func]() {
+                return func->get_ops().size();
+            });
+        }
+
         pass_timer.start();
 
         if (auto matcher_pass = dynamic_pointer_cast<MatcherPass>(pass)) {
@@ -90,17 +98,21 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             if (matcher_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) {
                 OPENVINO_DEBUG << "Pass " << pass->get_name() << " requires static shape but the "
                                << "model is dynamic. Skipping this transformation";
+                profile_scope.discard();
                 continue;
             }
             // GraphRewrite is a temporary container for MatcherPass to make execution
             // on on entire ngraph::Function
-            pass_applied = GraphRewrite(matcher_pass).run_on_model(func);
+            GraphRewrite rewrite(matcher_pass);
+            rewrite.set_pass_config(m_pass_config);
+            pass_applied = rewrite.run_on_model(func);
         } else if (auto function_pass = dynamic_pointer_cast<ModelPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
             // static shape but the function state is dynamic.
             if (function_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) {
                 OPENVINO_DEBUG << "Pass " << pass->get_name() << " requires static shape but the "
                                << "model is dynamic. Skipping this transformation";
+                profile_scope.discard();
                 continue;
             }
 
@@ -108,6 +120,8 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                 if (needs_validate) {
                     function_pass->run_on_model(func);
                     needs_validate = false;
+                } else {
+                    profile_scope.discard();
                 }
             } else {
                 pass_applied = function_pass->run_on_model(func);
@@ -116,6 +130,7 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             if (node_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) {
                 OPENVINO_DEBUG << "Pass " << pass->get_name() << " requires static shape but the "
                                << "model is dynamic. Skipping this transformation";
+                profile_scope.discard();
                 continue;
             }
             for (const shared_ptr<Node>& n : func->get_ops()) {
@@ -4,6 +4,13 @@
 
 #include "openvino/pass/pass_config.hpp"
 
+#include "openvino/util/env_util.hpp"
+
+ov::pass::PassConfig::PassConfig() {
+    static const bool parallel_sub_graphs = ov::util::getenv_bool("OV_PARALLEL_SUBGRAPH_TRANSFORMATIONS");
+    m_parallel_sub_graphs = parallel_sub_graphs;
+}
+
 ov::pass::param_callback ov::pass::PassConfig::get_callback(const DiscreteTypeInfo& type_info) const {
     const auto& it = m_callback_map.find(type_info);
     if (it != m_callback_map.end()) {
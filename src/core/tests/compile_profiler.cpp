@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/compile_profiler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/manager.hpp"
+
+namespace {
+class AddRelu : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("AddRelu");
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override {
+        auto result = model->get_results()[0];
+        auto relu = std::make_shared<ov::opset8::Relu>(result->input_value(0));
+        result->input(0).replace_source_output(relu);
+        return true;
+    }
+};
+
+class CompileProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ov::CompileProfiler::get().clear();
+        ov::CompileProfiler::get().enable();
+    }
+
+    void TearDown() override {
+        ov::CompileProfiler::get().disable();
+        ov::CompileProfiler::get().clear();
+    }
+};
+}  // namespace
+
+TEST_F(CompileProfilerTest, PassIsRecorded) {
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 3});
+    auto abs = std::make_shared<ov::opset8::Abs>(data);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{abs}, ov::ParameterVector{data});
+
+    ov::pass::Manager manager;
+    manager.register_pass<AddRelu>();
+    manager.run_passes(model);
+
+    const auto records = ov::CompileProfiler::get().get_records();
+    auto record = std::find_if(records.begin(), records.end(), [](const ov::CompileProfiler::Record& record) {
+        return record.name == "AddRelu";
+    });
+    ASSERT_NE(record, records.end());
+    EXPECT_EQ(record->category, "pass");
+    EXPECT_EQ(record->nodes_before, 3);
+    EXPECT_EQ(record->nodes_after, 4);
+    EXPECT_GE(record->time_ms, 0.0);
+
+    std::stringstream csv;
+    ov::CompileProfiler::get().dump_csv(csv);
+    EXPECT_EQ(csv.str().find("category,name,depth,time_ms,nodes_before,nodes_after,peak_rss_delta_kb\n"), 0);
+    EXPECT_NE(csv.str().find("pass,AddRelu,0,"), std::string::npos);
+
+    std::stringstream json;
+    ov::CompileProfiler::get().dump_json(json);
+    EXPECT_NE(json.str().find("\"name\": \"AddRelu\""), std::string::npos);
+}
+
+TEST_F(CompileProfilerTest, NestedScopesAndDiscard) {
+    {
+        ov::CompileProfiler::Scope outer;
+        outer.start("stage", "outer", nullptr);
+        {
+            ov::CompileProfiler::Scope inner;
+            inner.start("stage", "inner", nullptr);
+        }
+        {
+            ov::CompileProfiler::Scope skipped;
+            skipped.start("stage", "skipped", nullptr);
+            skipped.discard();
+        }
+    }
+
+    const auto records = ov::CompileProfiler::get().get_records();
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[0].name, "inner");
+    EXPECT_EQ(records[0].depth, 1);
+    EXPECT_EQ(records[1].name, "outer");
+    EXPECT_EQ(records[1].depth, 0);
+}
+
+TEST_F(CompileProfilerTest, NothingIsRecordedWhenDisabled) {
+    ov::CompileProfiler::get().disable();
+    {
+        ov::CompileProfiler::Scope scope;
+        scope.start("stage", "disabled", nullptr);
+    }
+    EXPECT_TRUE(ov::CompileProfiler::get().get_records().empty());
+}
@@ -6,6 +6,7 @@
 
 #include <transformations/utils/utils.hpp>
 
+#include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/ngraph_test_utils.hpp"
 #include "gmock/gmock.h"
 #include "ngraph/ngraph.hpp"
@@ -13,6 +14,7 @@
 #include "ngraph/opsets/opset5.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "openvino/opsets/opset11.hpp"
+#include "openvino/pass/constant_folding_cache.hpp"
 #include "transformations/common_optimizations/disable_shapeof_constant_folding.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
@@ -3911,3 +3913,130 @@ TEST(constant_folding, gather_with_dynamic_shapes_in_data_input) {
     check_names(strided_slice, {"strided_slice"}, "strided_slice");
     check_names(res, {"result"}, "result");
 }
+
+// The sizes exceed the grain of the parallel reference kernels, so every op is folded by several threads
+TEST(constant_folding, large_dequantization_subgraph) {
+    const size_t rows = 512, cols = 256, out_cols = 8;
+    std::vector<uint8_t> weights_values(rows * cols);
+    for (size_t i = 0; i < weights_values.size(); i++)
+        weights_values[i] = static_cast<uint8_t>(i % 251);
+    std::vector<float> zero_points(rows);
+    for (size_t r = 0; r < rows; r++)
+        zero_points[r] = static_cast<float>(r % 7);
+    std::vector<float> rhs_values(rows * out_cols);
+    for (size_t i = 0; i < rhs_values.size(); i++)
+        rhs_values[i] = static_cast<float>(i % out_cols + 1);
+
+    auto weights = ov::opset11::Constant::create(element::u8, Shape{rows, cols}, weights_values);
+    auto convert = std::make_shared<ov::opset11::Convert>(weights, element::f32);
+    auto zero_point = ov::opset11::Constant::create(element::f32, Shape{rows, 1}, zero_points);
+    auto subtract = std::make_shared<ov::opset11::Subtract>(convert, zero_point);
+    auto scale = ov::opset11::Constant::create(element::f32, Shape{rows, 1}, {0.5f});
+    auto multiply = std::make_shared<ov::opset11::Multiply>(subtract, scale);
+    auto order = ov::opset11::Constant::create(element::i64, Shape{2}, {1, 0});
+    auto transpose = std::make_shared<ov::opset11::Transpose>(multiply, order);
+    auto rhs = ov::opset11::Constant::create(element::f32, Shape{rows, out_cols}, rhs_values);
+    auto matmul = std::make_shared<ov::opset11::MatMul>(transpose, rhs);
+    auto indices = ov::opset11::Constant::create(element::i32, Shape{3}, {255, 0, 17});
+    auto axis = ov::opset11::Constant::create(element::i32, Shape{}, {0});
+    auto gather = std::make_shared<ov::opset11::Gather>(matmul, indices, axis);
+    auto model = std::make_shared<ov::Model>(NodeVector{gather}, ParameterVector{});
+
+    run_constant_folding(model);
+
+    auto result_node = get_result_constant(model);
+    ASSERT_TRUE(result_node);
+    ASSERT_EQ((Shape{3, out_cols}), result_node->get_output_shape(0));
+    std::vector<float> expected;
+    for (const size_t c : {255, 0, 17}) {
+        for (size_t j = 0; j < out_cols; j++) {
+            float sum = 0;
+            for (size_t r = 0; r < rows; r++)
+                sum += (weights_values[r * cols + c] - zero_points[r]) * 0.5f * rhs_values[r * out_cols + j];
+            expected.push_back(sum);
+        }
+    }
+    ASSERT_EQ(expected, result_node->cast_vector<float>());
+}
+
+namespace {
+std::shared_ptr<ov::Model> make_dequantization_model() {
+    std::vector<uint8_t> weights_values(64 * 256);
+    for (size_t i = 0; i < weights_values.size(); i++)
+        weights_values[i] = static_cast<uint8_t>(i % 253);
+    auto weights = ov::opset11::Constant::create(element::u8, Shape{64, 256}, weights_values);
+    auto convert = std::make_shared<ov::opset11::Convert>(weights, element::f32);
+    auto scale = ov::opset11::Constant::create(element::f32, Shape{64, 1}, {0.25f});
+    auto multiply = std::make_shared<ov::opset11::Multiply>(convert, scale);
+    return std::make_shared<ov::Model>(NodeVector{multiply}, ParameterVector{});
+}
+
+class ConstantFoldingCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ov::pass::ConstantFoldingCache::get().clear();
+        ov::pass::ConstantFoldingCache::get().enable();
+    }
+
+    void TearDown() override {
+        ov::pass::ConstantFoldingCache::get().disable();
+        ov::pass::ConstantFoldingCache::get().clear();
+    }
+};
+}  // namespace
+
+TEST_F(ConstantFoldingCacheTest, same_subgraph_is_folded_once) {
+    auto& cache = ov::pass::ConstantFoldingCache::get();
+    auto first = make_dequantization_model();
+    run_constant_folding(first);
+    const auto hits = cache.get_hits();
+
+    auto second = make_dequantization_model();
+    run_constant_folding(second);
+    // both Convert and Multiply are found
+    EXPECT_EQ(hits + 2, cache.get_hits());
+
+    auto first_result = get_result_constant(first);
+    auto second_result = get_result_constant(second);
+    ASSERT_TRUE(first_result);
+    ASSERT_TRUE(second_result);
+    EXPECT_EQ(first_result->get_data_ptr(), second_result->get_data_ptr());
+    EXPECT_EQ(first_result->cast_vector<float>(), second_result->cast_vector<float>());
+}
+
+TEST_F(ConstantFoldingCacheTest, different_attributes_are_not_mixed) {
+    auto& cache = ov::pass::ConstantFoldingCache::get();
+    auto first = make_dequantization_model();
+    run_constant_folding(first);
+    const auto hits = cache.get_hits();
+
+    std::vector<uint8_t> weights_values(64 * 256, 3);
+    auto weights = ov::opset11::Constant::create(element::u8, Shape{64, 256}, weights_values);
+    auto convert = std::make_shared<ov::opset11::Convert>(weights, element::i32);
+    auto model = std::make_shared<ov::Model>(NodeVector{convert}, ParameterVector{});
+    run_constant_folding(model);
+
+    EXPECT_EQ(hits, cache.get_hits());
+    EXPECT_EQ(std::vector<int32_t>(64 * 256, 3), get_result_constant(model)->cast_vector<int32_t>());
+}
+
+TEST_F(ConstantFoldingCacheTest, results_are_loaded_from_cache_dir) {
+    auto& cache = ov::pass::ConstantFoldingCache::get();
+    const auto cache_dir = CommonTestUtils::generateTestFilePrefix() + "_folding_cache";
+    cache.enable(cache_dir);
+    auto first = make_dequantization_model();
+    run_constant_folding(first);
+    const auto expected = get_result_constant(first)->cast_vector<float>();
+
+    // the results kept in memory are dropped, so they can be taken from the files only
+    cache.clear();
+    const auto hits = cache.get_hits();
+    auto second = make_dequantization_model();
+    run_constant_folding(second);
+    EXPECT_EQ(hits + 2, cache.get_hits());
+    EXPECT_EQ(expected, get_result_constant(second)->cast_vector<float>());
+
+    cache.enable();
+    CommonTestUtils::removeFilesWithExt(cache_dir, "ovcf");
+    CommonTestUtils::removeDir(cache_dir);
+}
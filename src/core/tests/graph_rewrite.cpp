@@ -4,8 +4,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include <common_test_utils/ngraph_test_utils.hpp>
 #include <ngraph/opsets/opset3.hpp>
+#include <ngraph/opsets/opset8.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
 
@@ -442,3 +445,62 @@ TEST(GraphRewriteTest, nodes_use_count) {
     m.register_pass<CheckConsumers>();
     ASSERT_NO_THROW(m.run_passes(f));
 }
+
+namespace {
+std::shared_ptr<Function> get_function_with_sub_graphs(size_t sub_graphs_num) {
+    auto cond = std::make_shared<opset8::Parameter>(element::boolean, Shape{});
+    auto data = std::make_shared<opset8::Parameter>(element::f32, Shape{3, 1, 2});
+    OutputVector outputs;
+    for (size_t i = 0; i < sub_graphs_num; ++i) {
+        auto then_body = get_function();
+        auto else_body = get_function();
+        auto if_op = std::make_shared<opset8::If>(cond);
+        if_op->set_then_body(then_body);
+        if_op->set_else_body(else_body);
+        if_op->set_input(data, then_body->get_parameters()[0], else_body->get_parameters()[0]);
+        outputs.push_back(if_op->set_output(then_body->get_results()[0], else_body->get_results()[0]));
+    }
+    return std::make_shared<Function>(outputs, ParameterVector{cond, data});
+}
+
+size_t count_relu_in_sub_graphs(const std::shared_ptr<Function>& f) {
+    size_t count = 0;
+    for (const auto& op : f->get_ops()) {
+        if (auto if_op = std::dynamic_pointer_cast<opset8::If>(op)) {
+            count += count_ops_of_type<opset3::Relu>(if_op->get_then_body());
+            count += count_ops_of_type<opset3::Relu>(if_op->get_else_body());
+        }
+    }
+    return count;
+}
+}  // namespace
+
+TEST(GraphRewriteTest, ParallelSubGraphs) {
+    auto f = get_function_with_sub_graphs(8);
+
+    pass::Manager manager;
+    auto anchor = manager.register_pass<Anchor>();
+    anchor->add_matcher<TestPass>();
+    auto pass_config = manager.get_pass_config();
+    pass_config->set_callback(get_callback());
+    pass_config->set_parallel_sub_graphs(true);
+    manager.run_passes(f);
+
+    ASSERT_EQ(count_relu_in_sub_graphs(f), 16);
+}
+
+TEST(GraphRewriteTest, ParallelSubGraphsNotRecreatablePass) {
+    auto f = get_function_with_sub_graphs(4);
+
+    // the pass refers to the external state, so the bodies are processed serially by the original instance
+    NodeVector order;
+    pass::Manager manager;
+    manager.register_pass<GatherNodesPass>(order);
+    manager.get_pass_config()->set_parallel_sub_graphs(true);
+    manager.run_passes(f);
+
+    const auto divides_num = std::count_if(order.begin(), order.end(), [](const std::shared_ptr<Node>& node) {
+        return ov::is_type<opset3::Divide>(node);
+    });
+    ASSERT_EQ(divides_num, 8);
+}
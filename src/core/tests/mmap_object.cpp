@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/mmap_object.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "gtest/gtest.h"
+
+TEST(mmap_object, prefetch_keeps_content) {
+    const auto path = CommonTestUtils::generateTestFilePrefix() + "_mmap_object.bin";
+    // not a multiple of the page size
+    std::vector<char> content((1 << 20) + 17);
+    for (size_t i = 0; i < content.size(); i++) {
+        content[i] = static_cast<char>(i * 31);
+    }
+    {
+        std::ofstream stream(path, std::ios::binary);
+        stream.write(content.data(), content.size());
+    }
+
+    {
+        auto mapping = ov::load_mmap_object(path);
+        ASSERT_EQ(content.size(), mapping->size());
+        ov::prefetch_mmap_object(mapping);
+        mapping->prefetch(4095, 8192);
+        // out of range requests are ignored
+        mapping->prefetch(mapping->size(), 1024);
+        mapping->prefetch(mapping->size() - 1, 1024);
+        ASSERT_EQ(0, std::memcmp(content.data(), mapping->data(), content.size()));
+    }
+    std::remove(path.c_str());
+}
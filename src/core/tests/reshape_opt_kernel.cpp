@@ -8,6 +8,8 @@
 #include "gtest/gtest.h"
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape.hpp"
 #include "util/ndarray.hpp"
 
@@ -220,3 +222,37 @@ INSTANTIATE_TEST_SUITE_P(reshape_opt_kernel_ref_impl_fallback,
                                                           {11, 21, 13, 23, 15, 25},
                                                           {12, 22, 14, 24, 16, 26},
                                                       }}));
+
+// big inputs are transposed by several threads
+TEST(reshape_opt_kernel, parallel_transpose_matches_reference) {
+    runtime::reference::ParallelScope parallel;
+    const std::vector<std::pair<Shape, AxisVector>> cases{{{300, 700}, {1, 0}},
+                                                          {{7, 50, 3, 130}, {2, 0, 3, 1}},
+                                                          {{2, 3, 4, 5, 6, 7, 8}, {6, 5, 4, 3, 2, 1, 0}}};
+    for (const auto& test_case : cases) {
+        const auto& in_shape = test_case.first;
+        const auto& axis_order = test_case.second;
+        Shape out_shape;
+        for (const auto axis : axis_order) {
+            out_shape.push_back(in_shape[axis]);
+        }
+        std::vector<ElementValue> input(shape_size(in_shape));
+        std::iota(input.begin(), input.end(), 0);
+        std::vector<ElementValue> output(input.size());
+        std::vector<ElementValue> expected(input.size());
+
+        runtime::opt_kernel::reshape((const char*)input.data(),
+                                     (char*)output.data(),
+                                     in_shape,
+                                     axis_order,
+                                     out_shape,
+                                     sizeof(ElementValue));
+        runtime::reference::reshape((const char*)input.data(),
+                                    (char*)expected.data(),
+                                    in_shape,
+                                    axis_order,
+                                    out_shape,
+                                    sizeof(ElementValue));
+        EXPECT_EQ(expected, output);
+    }
+}
@@ -7,11 +7,14 @@
 #include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <memory>
 #include <utility>
 #include <vector>
 
 #include "exceptions.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_common/utils.hpp"
@@ -76,10 +79,15 @@ inline std::vector<T> __get_data(const Container& container) {
 #endif
 }
 
+template <typename T>
+inline std::vector<T> __get_raw_data(const char* raw_data, size_t raw_data_size, int onnx_data_type) {
+    auto it = reinterpret_cast<const T*>(raw_data);
+    return std::vector<T>(it, it + (raw_data_size / onnx_common::get_onnx_data_size(onnx_data_type)));
+}
+
 template <typename T>
 inline std::vector<T> __get_raw_data(const std::string& raw_data, int onnx_data_type) {
-    auto it = reinterpret_cast<const T*>(raw_data.data());
-    return std::vector<T>(it, it + (raw_data.size() / onnx_common::get_onnx_data_size(onnx_data_type)));
+    return __get_raw_data<T>(raw_data.data(), raw_data.size(), onnx_data_type);
 }
 
 }  // namespace
@@ -108,10 +116,19 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor, const std::string& model_dir)
+    /// \param mmap_cache   Files mapped for the external data of the model, nullptr if the
+    ///                     external data is read instead of mapped.
+    /// \param model_proto  ModelProto which owns the tensor. If set, the constants created from
+    ///                     the tensor refer to its raw data instead of copying it.
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                    const std::string& model_dir,
+                    detail::MappedMemoryHandles mmap_cache,
+                    std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto = nullptr)
         : m_tensor_proto{&tensor},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
-          m_model_dir{model_dir} {
+          m_model_dir{model_dir},
+          m_mmap_cache{std::move(mmap_cache)},
+          m_model_proto{std::move(model_proto)} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -237,16 +254,14 @@ private:
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
-        size_t data_size = get_data_size();
         if (has_external_data()) {
-            auto external_data = load_external_data();
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
-            if (constant->get_byte_size() != external_data.size()) {
-                throw error::invalid_external_data(
-                    "The size of the external data file does not match the byte size of an initializer '" + get_name() +
-                    "' in the model");
-            }
-        } else if (data_size == shape_size(m_shape)) {
+            return make_external_ng_constant(type);
+        }
+        if (auto raw_data_constant = make_raw_data_ng_constant(type)) {
+            return raw_data_constant;
+        }
+        size_t data_size = get_data_size();
+        if (data_size == shape_size(m_shape)) {
             constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data_ptr());
         } else if (data_size == 0 && m_shape.size() == 0) {
             constant = common::make_failsafe_constant(type);
@@ -267,6 +282,12 @@ private:
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
+        if (has_external_data()) {
+            return make_external_ng_constant(type);
+        }
+        if (auto raw_data_constant = make_raw_data_ng_constant(type)) {
+            return raw_data_constant;
+        }
         auto data = get_data<T>();
         auto data_size = data.size();
         if (data_size == shape_size(m_shape)) {
@@ -288,14 +309,84 @@ private:
                    ONNX_NAMESPACE::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL;
     }
 
+    std::shared_ptr<detail::MappedBuffer> load_external_mmap_data() const {
+        const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
+        return tensor_external_data.load_external_mmap_data(m_model_dir, m_mmap_cache);
+    }
+
     std::string load_external_data() const {
         const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
         return tensor_external_data.load_external_data(m_model_dir);
     }
 
+    // The external data files are mapped unless the mapping is disabled for the model
+    bool is_external_data_mapped() const {
+        return m_mmap_cache != nullptr;
+    }
+
     template <typename T>
     std::vector<T> get_external_data() const {
-        return detail::__get_raw_data<T>(load_external_data(), m_tensor_proto->data_type());
+        if (!is_external_data_mapped()) {
+            return detail::__get_raw_data<T>(load_external_data(), m_tensor_proto->data_type());
+        }
+        const auto external_data = load_external_mmap_data();
+        return detail::__get_raw_data<T>(external_data->get_ptr<char>(),
+                                         external_data->size(),
+                                         m_tensor_proto->data_type());
+    }
+
+    // The constant refers to the mapped external data file directly, the mapping is kept alive
+    // as long as the constant exists. The data is copied if the mapping is disabled or the data
+    // isn't aligned to the element size in the file.
+    std::shared_ptr<ngraph::op::Constant> make_external_ng_constant(const element::Type& type) const {
+        std::shared_ptr<default_opset::Constant> constant{nullptr};
+        if (!is_external_data_mapped()) {
+            const auto external_data = load_external_data();
+            check_external_data_size(type, external_data.size());
+            constant = std::make_shared<default_opset::Constant>(type, m_shape, external_data.data());
+        } else {
+            const auto external_data = load_external_mmap_data();
+            check_external_data_size(type, external_data->size());
+            if (reinterpret_cast<uintptr_t>(external_data->get_ptr()) % type.size() != 0) {
+                constant = std::make_shared<default_opset::Constant>(type, m_shape, external_data->get_ptr());
+            } else {
+                constant = std::make_shared<default_opset::Constant>(type, m_shape, external_data);
+            }
+        }
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
+    }
+
+    void check_external_data_size(const element::Type& type, size_t data_size) const {
+        if (shape_size(m_shape) * type.size() != data_size) {
+            throw error::invalid_external_data(
+                "The size of the external data file does not match the byte size of an initializer '" + get_name() +
+                "' in the model");
+        }
+    }
+
+    // The constant refers to the raw data of the tensor and keeps the owning ModelProto alive.
+    // Returns nullptr if the data has to be copied: the owner is unknown, the data is stored in
+    // the typed fields, its size doesn't match the shape or it's not aligned to the element size.
+    std::shared_ptr<ngraph::op::Constant> make_raw_data_ng_constant(const element::Type& type) const {
+        if (!m_model_proto || !m_tensor_proto->has_raw_data()) {
+            return nullptr;
+        }
+        const auto& raw_data = m_tensor_proto->raw_data();
+        if (raw_data.empty() || raw_data.size() != shape_size(m_shape) * type.size() ||
+            reinterpret_cast<uintptr_t>(raw_data.data()) % type.size() != 0) {
+            return nullptr;
+        }
+        using RawDataBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<const ONNX_NAMESPACE::ModelProto>>;
+        auto buffer =
+            std::make_shared<RawDataBuffer>(const_cast<char*>(raw_data.data()), raw_data.size(), m_model_proto);
+        auto constant = std::make_shared<default_opset::Constant>(type, m_shape, buffer);
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
     }
 
     const void* get_data_ptr() const {
@@ -339,6 +430,8 @@ private:
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
     std::string m_model_dir;
+    detail::MappedMemoryHandles m_mmap_cache;
+    std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_model_proto;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
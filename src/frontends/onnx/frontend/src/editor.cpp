@@ -302,6 +302,15 @@ struct onnx_editor::ONNXModelEditor::Impl {
         graph_topological_sort(m_model_proto->mutable_graph());
     }
 
+    // The constants of the converted models refer to the initializers data and keep the ModelProto alive,
+    // so the shared ModelProto is copied before the initializers are removed or modified
+    void detach_model_proto() {
+        if (m_model_proto.use_count() > 1) {
+            m_model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>(*m_model_proto);
+            m_is_mapper_updated = false;
+        }
+    }
+
     Impl(const std::string& model_path)
         : Impl(std::make_shared<ONNX_NAMESPACE::ModelProto>(ngraph::onnx_common::parse_from_file(model_path))) {}
 
@@ -315,17 +324,23 @@ struct onnx_editor::ONNXModelEditor::Impl {
 #endif
 };
 
-onnx_editor::ONNXModelEditor::ONNXModelEditor(const std::string& model_path, frontend::ExtensionHolder extensions)
+onnx_editor::ONNXModelEditor::ONNXModelEditor(const std::string& model_path,
+                                              const bool enable_mmap,
+                                              frontend::ExtensionHolder extensions)
     : m_extensions{std::move(extensions)},
       m_model_path{model_path},
+      m_enable_mmap{enable_mmap},
       m_pimpl{new ONNXModelEditor::Impl{model_path}, [](Impl* impl) {
                   delete impl;
               }} {}
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-onnx_editor::ONNXModelEditor::ONNXModelEditor(const std::wstring& model_path, frontend::ExtensionHolder extensions)
+onnx_editor::ONNXModelEditor::ONNXModelEditor(const std::wstring& model_path,
+                                              const bool enable_mmap,
+                                              frontend::ExtensionHolder extensions)
     : m_extensions{std::move(extensions)},
       m_model_path{ov::util::wstring_to_string(model_path)},
+      m_enable_mmap{enable_mmap},
       m_pimpl{new ONNXModelEditor::Impl{model_path}, [](Impl* impl) {
                   delete impl;
               }} {}
@@ -333,9 +348,11 @@ onnx_editor::ONNXModelEditor::ONNXModelEditor(const std::wstring& model_path, fr
 
 onnx_editor::ONNXModelEditor::ONNXModelEditor(std::istream& model_stream,
                                               const std::string& model_path,
+                                              const bool enable_mmap,
                                               frontend::ExtensionHolder extensions)
     : m_extensions{std::move(extensions)},
       m_model_path{model_path},
+      m_enable_mmap{enable_mmap},
       m_pimpl{new ONNXModelEditor::Impl{model_stream}, [](Impl* impl) {
                   delete impl;
               }} {}
@@ -445,6 +462,7 @@ void onnx_editor::ONNXModelEditor::extract_subgraph(const std::vector<InputEdge>
         return;
     }
 
+    m_pimpl->detach_model_proto();
     if (!outputs.empty()) {
         m_pimpl->m_model_proto->mutable_graph()->mutable_output()->Clear();
     }
@@ -522,11 +540,15 @@ std::string onnx_editor::ONNXModelEditor::model_string() const {
 }
 
 std::shared_ptr<Model> onnx_editor::ONNXModelEditor::get_function() const {
-    return ngraph::onnx_import::detail::import_onnx_model(m_pimpl->m_model_proto, m_model_path, m_extensions);
+    return ngraph::onnx_import::detail::import_onnx_model(m_pimpl->m_model_proto,
+                                                         m_model_path,
+                                                         m_enable_mmap,
+                                                         m_extensions);
 }
 
 void onnx_editor::ONNXModelEditor::set_input_values(
     const std::map<std::string, std::shared_ptr<ngraph::op::Constant>>& input_values) {
+    m_pimpl->detach_model_proto();
     auto onnx_graph = m_pimpl->m_model_proto->mutable_graph();
 
     for (const auto& input : input_values) {
@@ -713,7 +735,10 @@ std::vector<std::string> onnx_editor::ONNXModelEditor::get_output_ports(const Ed
 }
 
 std::shared_ptr<Model> onnx_editor::ONNXModelEditor::decode() {
-    return ngraph::onnx_import::detail::decode_to_framework_nodes(m_pimpl->m_model_proto, m_model_path, m_extensions);
+    return ngraph::onnx_import::detail::decode_to_framework_nodes(m_pimpl->m_model_proto,
+                                                                 m_model_path,
+                                                                 m_enable_mmap,
+                                                                 m_extensions);
 }
 
 void onnx_editor::ONNXModelEditor::add_output(const OutputEdge& output_edge) const {
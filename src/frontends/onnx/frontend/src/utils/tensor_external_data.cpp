@@ -48,7 +48,7 @@ std::string TensorExternalData::load_external_data(const std::string& model_dir)
         throw error::invalid_external_data{*this};
     }
     const uint64_t file_size = static_cast<uint64_t>(external_data_stream.tellg());
-    if (m_offset + m_data_length > file_size) {
+    if (m_offset > file_size || m_data_length > file_size - m_offset) {
         throw error::invalid_external_data{*this};
     }
 
@@ -69,6 +69,53 @@ std::string TensorExternalData::load_external_data(const std::string& model_dir)
     return read_data;
 }
 
+std::shared_ptr<MappedBuffer> TensorExternalData::load_external_mmap_data(const std::string& model_dir,
+                                                                        const MappedMemoryHandles& cache) const {
+    NGRAPH_SUPPRESS_DEPRECATED_START
+    auto full_path = file_util::path_join(model_dir, m_data_location);
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    file_util::convert_path_win_style(full_path);
+#endif
+    NGRAPH_SUPPRESS_DEPRECATED_END
+
+    std::shared_ptr<ov::MappedMemory> mapped_memory;
+    if (cache) {
+        const auto cached = cache->find(full_path);
+        if (cached != cache->end()) {
+            mapped_memory = cached->second;
+        }
+    }
+    if (!mapped_memory) {
+        try {
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+            mapped_memory = ov::load_mmap_object(ov::util::string_to_wstring(full_path));
+#else
+            mapped_memory = ov::load_mmap_object(full_path);
+#endif
+        } catch (const std::exception&) {
+            throw error::invalid_external_data{*this};
+        }
+        if (cache) {
+            (*cache)[full_path] = mapped_memory;
+        }
+    }
+
+    const uint64_t file_size = static_cast<uint64_t>(mapped_memory->size());
+    if (m_offset > file_size || m_data_length > file_size - m_offset) {
+        throw error::invalid_external_data{*this};
+    }
+    // default value of m_offset is 0
+    const uint64_t data_length = m_data_length > 0 ? m_data_length : file_size - m_offset;
+
+    if (m_sha1_digest.size() > 0) {
+        OPENVINO_WARN << "SHA1 checksum is not supported";
+    }
+
+    return std::make_shared<MappedBuffer>(mapped_memory->data() + m_offset,
+                                          static_cast<size_t>(data_length),
+                                          mapped_memory);
+}
+
 std::string TensorExternalData::to_string() const {
     std::stringstream s;
     s << "ExternalDataInfo(";
@@ -6,9 +6,21 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+/// \brief  Files mapped for the external data of a model, the key is the full path of a file
+using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::MappedMemory>>>;
+/// \brief  Part of a mapped file, keeps the mapping alive
+using MappedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -16,13 +28,26 @@ public:
 
     /// \brief      Load external data from tensor passed to constructor
     ///
-    /// \note       If read data from external file fails,
     /// \note       If reading data from external files fails,
     ///             the invalid_external_data exception is thrown.
     ///
     /// \return     External binary data loaded into a std::string
     std::string load_external_data(const std::string& model_dir) const;
 
+    /// \brief      Map external data of tensor passed to constructor
+    ///
+    /// \note       If mapping of the external file fails or the file is too small,
+    ///             the invalid_external_data exception is thrown.
+    ///
+    /// \param      model_dir  Directory the data location is relative to
+    /// \param      cache      Already mapped files of the model, the newly mapped file is
+    ///                        added to it
+    ///
+    /// \return     Buffer pointing to the tensor data inside of the mapped file, keeps the
+    ///             mapping alive
+    std::shared_ptr<MappedBuffer> load_external_mmap_data(const std::string& model_dir,
+                                                          const MappedMemoryHandles& cache) const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
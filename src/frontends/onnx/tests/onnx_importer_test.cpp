@@ -181,3 +181,23 @@ TEST(ONNX_Importer_Tests, ImportModelWithMetadata) {
     ASSERT_EQ(metadata["meta_key1"].as<std::string>(), "meta_value1");
     ASSERT_EQ(metadata["meta_key2"].as<std::string>(), "meta_value2");
 }
+
+TEST(ONNX_Importer_Tests, ImportModelWithUnalignedExternalData) {
+    const auto model_path = CommonTestUtils::getModelFromTestModelZoo(
+        ov::util::path_join({ONNX_MODELS_DIR, "external_data/external_data_unaligned_offset.onnx"}));
+    for (const bool enable_mmap : {true, false}) {
+        ov::Core core;
+        core.set_property(ov::enable_mmap(enable_mmap));
+        const auto model = core.read_model(model_path);
+
+        std::shared_ptr<ov::op::v0::Constant> constant;
+        for (const auto& op : model->get_ops()) {
+            if (const auto& c = ov::as_type_ptr<ov::op::v0::Constant>(op))
+                constant = c;
+        }
+        ASSERT_NE(constant, nullptr);
+        // the data at the unaligned offset of the mapped file is copied
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(constant->get_data_ptr()) % sizeof(float), 0);
+        ASSERT_EQ(constant->get_vector<float>(), (std::vector<float>{1.f, 2.f, 3.f}));
+    }
+}
@@ -2,11 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
+
 #include "common_op_table.hpp"
 #include "graph_iterator_saved_model.hpp"
 #include "helper_ops/string_constant.hpp"
 #include "helper_ops/unsupported_constant.hpp"
 #include "input_model.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/opsets/opset8.hpp"
 #include "tensor_bundle.pb.h"
 
@@ -20,28 +23,39 @@ namespace tensorflow {
 namespace op {
 
 // Reading variable from shard file
+// The constant refers to the mapped shard and keeps it alive, the data is copied only if it isn't aligned properly
 template <typename T>
 static std::shared_ptr<ov::Node> read_variable(std::shared_ptr<VariablesIndex> var_index,
                                                const ov::element::Type ov_type,
                                                const ov::Shape shape,
                                                const ::tensorflow::BundleEntryProto& entry,
                                                const NodeContext& node) {
-    std::vector<T> var_data;
     google::protobuf::int64 size = 1;
     for (uint64_t i = 0; i < shape.size(); ++i) {
         size *= static_cast<google::protobuf::int64>(shape[i]);
     }
-    var_data.resize(size);
     TENSORFLOW_OP_VALIDATION(node,
                              size == static_cast<google::protobuf::int64>(entry.size() / sizeof(T)),
                              "[TensorFlow Frontend] Internal error: Available data size isn't equal to calculated.");
-    auto fs = var_index->get_data_file(entry.shard_id());
-    if (!fs.get()) {
+    auto mapped_memory = var_index->get_data_file(entry.shard_id());
+    if (!mapped_memory.get()) {
         TENSORFLOW_OP_VALIDATION(node, var_index, "[TensorFlow Frontend] Internal error: Cannot get shard file.");
     }
-    fs->seekg(entry.offset(), std::ios::beg);
-    fs->read(reinterpret_cast<char*>(var_data.data()), entry.size());
-    return std::make_shared<Constant>(ov_type, shape, var_data);
+    TENSORFLOW_OP_VALIDATION(node,
+                             static_cast<uint64_t>(entry.offset()) <= mapped_memory->size() &&
+                                 static_cast<uint64_t>(entry.size()) <= mapped_memory->size() - entry.offset(),
+                             "[TensorFlow Frontend] Internal error: Variable data is out of the shard file.");
+    char* data = mapped_memory->data() + entry.offset();
+    if (reinterpret_cast<uintptr_t>(data) % alignof(T) != 0) {
+        std::vector<T> var_data(size);
+        std::memcpy(var_data.data(), data, entry.size());
+        return std::make_shared<Constant>(ov_type, shape, var_data);
+    }
+    auto shared_buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+        data,
+        entry.size(),
+        mapped_memory);
+    return std::make_shared<Constant>(ov_type, shape, shared_buffer);
 }
 
 OutputVector translate_varhandle_op(const NodeContext& node) {
@@ -21,6 +21,29 @@ namespace ov {
 namespace frontend {
 namespace tensorflow {
 
+namespace {
+template <typename T>
+std::shared_ptr<ov::MappedMemory> map_data_file(const std::basic_string<T>& path) {
+    FRONT_END_GENERAL_CHECK(ov::util::file_exists(path), "Variable index data file does not exist");
+    try {
+        return ov::load_mmap_object(path);
+    } catch (const std::exception&) {
+        FRONT_END_GENERAL_CHECK(false, "Variable index data file cannot be mapped");
+    }
+    return nullptr;
+}
+
+// Variables are converted to constants referring to the mapped shards, so the shards are mostly read when the plugin
+// accesses the weights. The optional read-ahead is started for all the shards at once to keep the storage busy.
+void prefetch_data_files(const std::map<int32_t, std::shared_ptr<ov::MappedMemory>>& data_files) {
+    if (!ov::is_mmap_prefetch_enabled())
+        return;
+    for (const auto& data_file : data_files) {
+        ov::prefetch_mmap_object(data_file.second);
+    }
+}
+}  // namespace
+
 void VariablesIndex::read_variables_index_block(std::ifstream& fs,
                                                 const VIBlock& index,
                                                 std::vector<char>& data,
@@ -191,10 +214,9 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::string&
         } else {
             fullPath = path + "." + suffix.data();
         }
-        m_data_files[shard] = std::shared_ptr<std::ifstream>(
-            new std::ifstream(fullPath.c_str(), std::ifstream::in | std::ifstream::binary));
-        FRONT_END_GENERAL_CHECK(m_data_files[shard]->is_open(), "Variable index data file does not exist");
+        m_data_files[shard] = map_data_file(fullPath);
     }
+    prefetch_data_files(m_data_files);
 
     read_checkpointable_object_graph();
     return true;
@@ -215,10 +237,9 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::wstring
         } else {
             fullPath = path + L"." + suffix.data();
         }
-        m_data_files[shard] = std::shared_ptr<std::ifstream>(
-            new std::ifstream(fullPath.c_str(), std::ifstream::in | std::ifstream::binary));
-        FRONT_END_GENERAL_CHECK(m_data_files[shard]->is_open(), "Variable index data file does not exist");
+        m_data_files[shard] = map_data_file(fullPath);
     }
+    prefetch_data_files(m_data_files);
 
     read_checkpointable_object_graph();
     return true;
@@ -8,6 +8,7 @@
 
 #include "graph_iterator_proto.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "saved_model.pb.h"
 
 namespace ov {
@@ -24,8 +25,8 @@ class VariablesIndex {
     int32_t m_total_shards;
     // Contains BundleEntryProto variables list, readed from .index file
     std::map<std::string, std::vector<char>> m_variables_index;
-    // List of opened data files for using with BundleEntryProto
-    std::map<int32_t, std::shared_ptr<std::ifstream>> m_data_files;
+    // List of mapped data files for using with BundleEntryProto
+    std::map<int32_t, std::shared_ptr<ov::MappedMemory>> m_data_files;
     // List of mapped variables which could be read using TrackableObjectGraph
     std::map<std::string, std::string> m_variables_map;
 
@@ -87,8 +88,8 @@ public:
 
     /// \brief Returns shared pointer to a requested shard_id, or nullptr in case of shard_id isn't found
     /// \param shard_id Requested shard_id
-    /// \returns Valid shared_ptr with ifstream or with nullptr if shard isn't found
-    std::shared_ptr<std::ifstream> get_data_file(const int32_t shard_id) const {
+    /// \returns Valid shared_ptr with mapped shard file or with nullptr if shard isn't found
+    std::shared_ptr<ov::MappedMemory> get_data_file(const int32_t shard_id) const {
         auto result = m_data_files.find(shard_id);
         return result != m_data_files.end() ? result->second : nullptr;
     }
@@ -220,6 +220,14 @@ OPENVINO_RUNTIME_API std::vector<std::vector<int>> reserve_available_cpus(
  */
 OPENVINO_RUNTIME_API void set_cpu_used(const std::vector<int>& cpu_ids, const int used);
 
+/**
+ * @brief      Get id of the numa node the processors belong to
+ * @ingroup    ie_dev_api_system_conf
+ * @param[in]  cpu_ids cpus in cpu_mapping.
+ * @return     Id of the numa node holding most of the processors, -1 if it is unknown
+ */
+OPENVINO_RUNTIME_API int get_numa_node_id(const std::vector<int>& cpu_ids);
+
 /**
  * @enum       ColumnOfCPUMappingTable
  * @brief      This enum contains definition of each columns in CPU mapping table which use processor id as index.
@@ -7,6 +7,13 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
 #ifndef _WIN32
 #    include <unistd.h>
 #endif
@@ -17,9 +24,15 @@
 #include "file_utils.h"
 #include "ie_itt.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/op/loop.hpp"
+#include "openvino/op/util/framework_node.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/variable.hpp"
 #include "openvino/pass/manager.hpp"
 #include "transformations/fix_rt_info.hpp"
-#include "transformations/hash.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
@@ -52,6 +65,312 @@ uint64_t calculate_td(const InferenceEngine::TensorDesc& td, uint64_t _seed) {
     return seed;
 }
 
+// Hashes the raw bytes 4 words at a time with the independent lanes (the xxHash64 round), so the hash of a large
+// buffer is bound by the memory bandwidth instead of the dependency chain of hash_combine
+uint64_t hash_bytes(const uint8_t* data, size_t size, uint64_t seed) {
+    constexpr uint64_t prime1 = 11400714785074694791ULL;
+    constexpr uint64_t prime2 = 14029467366897019727ULL;
+    constexpr uint64_t prime3 = 1609587929392839161ULL;
+    constexpr uint64_t prime4 = 9650029242287828579ULL;
+    const auto rotl = [](uint64_t x, int r) {
+        return (x << r) | (x >> (64 - r));
+    };
+    const auto mix = [&](uint64_t acc, uint64_t input) {
+        return rotl(acc + input * prime2, 31) * prime1;
+    };
+    const auto load = [](const uint8_t* ptr) {
+        uint64_t value;
+        std::memcpy(&value, ptr, sizeof(value));
+        return value;
+    };
+
+    uint64_t lanes[4] = {seed + prime1 + prime2, seed + prime2, seed, seed - prime1};
+    size_t offset = 0;
+    for (; offset + 4 * sizeof(uint64_t) <= size; offset += 4 * sizeof(uint64_t)) {
+        for (size_t l = 0; l < 4; l++)
+            lanes[l] = mix(lanes[l], load(data + offset + l * sizeof(uint64_t)));
+    }
+    uint64_t hash = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) + rotl(lanes[3], 18) + size;
+    for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t))
+        hash = rotl(hash ^ mix(0, load(data + offset)), 27) * prime1 + prime4;
+    for (; offset < size; offset++)
+        hash = rotl(hash ^ (data[offset] * prime3), 11) * prime1;
+
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    hash *= prime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+// Hashes the chunks of a large buffer in parallel, the chunk hashes are combined in order, so the result doesn't
+// depend on the number of threads
+uint64_t hash_buffer(const void* data, size_t size, uint64_t seed) {
+    constexpr size_t chunk_size = 1 << 20;
+    const auto bytes = static_cast<const uint8_t*>(data);
+    if (size <= chunk_size)
+        return ov::hash_combine(seed, hash_bytes(bytes, size, 0));
+
+    const size_t chunks = (size + chunk_size - 1) / chunk_size;
+    std::vector<uint64_t> chunk_hashes(chunks);
+    ov::parallel_for(chunks, [&](size_t chunk) {
+        const size_t offset = chunk * chunk_size;
+        chunk_hashes[chunk] = hash_bytes(bytes + offset, std::min(chunk_size, size - offset), chunk);
+    });
+    for (const auto& chunk_hash : chunk_hashes)
+        seed = ov::hash_combine(seed, chunk_hash);
+    return seed;
+}
+
+uint64_t hash_rt_info(const ov::RTMap& rt_info, uint64_t seed) {
+    for (const auto& rtMapData : rt_info) {
+        seed = ov::hash_combine(seed, rtMapData.first);
+        std::stringstream strm;
+        rtMapData.second.print(strm);
+        seed = ov::hash_combine(seed, strm.str());
+    }
+    return seed;
+}
+
+uint64_t hash_model(const ov::Model& model, uint64_t seed);
+
+/**
+ * Hashes the attributes of an operation as they are visited, the constants data is hashed directly from the constant
+ * buffer and the bodies of the sub-graph operations are hashed recursively. The attribute types the serialization
+ * doesn't support are rejected as the serialization did
+ */
+class HashVisitor : public ov::AttributeVisitor {
+public:
+    explicit HashVisitor(uint64_t seed) : m_seed(seed) {}
+
+    uint64_t get_hash() const {
+        return m_seed;
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        hash(name);
+        if (const auto& a =
+                ov::as_type<ov::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            const auto& buffer = a->get();
+            if (buffer) {
+                hash(buffer->size());
+                m_seed = hash_buffer(buffer->get_ptr(), buffer->size(), m_seed);
+            }
+        } else if (const auto& a =
+                       ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::op::util::Variable>>>(&adapter)) {
+            hash(a->get()->get_info().variable_id);
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+            hash(a->get().to_string());
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::Dimension>>(&adapter)) {
+            std::stringstream strm;
+            strm << a->get();
+            hash(strm.str());
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::element::TypeVector>>(&adapter)) {
+            for (const auto& type : a->get())
+                hash(type.get_type_name());
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(&adapter)) {
+            const auto& attrs = a->get();
+            hash(attrs.get_type_name());
+            hash(attrs.get_opset_name());
+            // the attributes are kept in an unordered map
+            for (const auto& attr : std::map<std::string, std::string>(attrs.begin(), attrs.end())) {
+                hash(attr.first);
+                hash(attr.second);
+            }
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<
+                       std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::InputDescription>>>>(&adapter)) {
+            using namespace ov::op::util;
+            for (const auto& desc : a->get()) {
+                hash(std::string(desc->get_type_info().name));
+                hash(desc->m_input_index);
+                hash(desc->m_body_parameter_index);
+                if (const auto& slice = ov::as_type_ptr<MultiSubGraphOp::SliceInputDescription>(desc)) {
+                    hash_slice(*slice);
+                } else if (const auto& merged = ov::as_type_ptr<MultiSubGraphOp::MergedInputDescription>(desc)) {
+                    hash(merged->m_body_value_index);
+                }
+            }
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<
+                       std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::OutputDescription>>>>(&adapter)) {
+            using namespace ov::op::util;
+            for (const auto& desc : a->get()) {
+                hash(std::string(desc->get_type_info().name));
+                hash(desc->m_body_value_index);
+                hash(desc->m_output_index);
+                if (const auto& concat = ov::as_type_ptr<MultiSubGraphOp::ConcatOutputDescription>(desc)) {
+                    hash_slice(*concat);
+                } else if (const auto& body = ov::as_type_ptr<MultiSubGraphOp::BodyOutputDescription>(desc)) {
+                    hash(body->m_iteration);
+                }
+            }
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            hash(a->get().current_iteration_input_idx);
+            hash(a->get().body_condition_output_idx);
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<std::set<std::string>>>(&adapter)) {
+            hash(a->get().size());
+            for (const auto& value : a->get())
+                hash(value);
+        } else {
+            // the value isn't accessible, two models differing in it only would share the cache entry
+            OPENVINO_THROW("Unsupported attribute type for hashing: ", name);
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int8_t>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int16_t>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int32_t>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint8_t>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint16_t>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint32_t>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint64_t>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<float>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        hash_values(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        hash_values(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        hash_values(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        hash_values(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        hash_values(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        hash_values(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        hash_values(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        hash_values(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        hash_values(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<double>>& adapter) override {
+        hash_values(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        hash_values(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        hash(name);
+        if (const auto& body = adapter.get())
+            m_seed = hash_model(*body, m_seed);
+    }
+
+private:
+    template <typename T>
+    void hash(const T& value) {
+        m_seed = ov::hash_combine(m_seed, value);
+    }
+
+    template <typename T>
+    void hash_value(const std::string& name, const T& value) {
+        hash(name);
+        hash(value);
+    }
+
+    template <typename T>
+    void hash_values(const std::string& name, const std::vector<T>& values) {
+        hash(name);
+        hash(values.size());
+        for (const auto& value : values)
+            hash(value);
+    }
+
+    template <typename T>
+    void hash_slice(const T& slice) {
+        hash(slice.m_start);
+        hash(slice.m_stride);
+        hash(slice.m_part_size);
+        hash(slice.m_end);
+        hash(slice.m_axis);
+    }
+
+    uint64_t m_seed;
+};
+
+// Hashes the model structure without the serialization: the operations types and attributes, the connections, the
+// output types, shapes and tensor names and the runtime information. The auto generated names are skipped, so the
+// identical models created independently have the same hash
+uint64_t hash_model(const ov::Model& model, uint64_t seed) {
+    if (model.get_friendly_name() != model.get_name())
+        seed = ov::hash_combine(seed, model.get_friendly_name());
+    seed = hash_rt_info(model.get_rt_info(), seed);
+
+    const auto ops = model.get_ordered_ops();
+    std::unordered_map<const ov::Node*, size_t> op_ids;
+    for (const auto& op : ops) {
+        const auto op_id = op_ids.size();
+        op_ids[op.get()] = op_id;
+
+        const auto& type_info = op->get_type_info();
+        seed = ov::hash_combine(seed, std::string(type_info.name));
+        seed = ov::hash_combine(seed, type_info.get_version());
+        if (op->get_friendly_name() != op->get_name())
+            seed = ov::hash_combine(seed, op->get_friendly_name());
+        seed = hash_rt_info(op->get_rt_info(), seed);
+
+        for (const auto& input : op->inputs()) {
+            const auto& source = input.get_source_output();
+            seed = ov::hash_combine(seed, op_ids.at(source.get_node()));
+            seed = ov::hash_combine(seed, source.get_index());
+            seed = hash_rt_info(input.get_rt_info(), seed);
+        }
+        for (const auto& output : op->outputs()) {
+            seed = ov::hash_combine(seed, output.get_element_type().get_type_name());
+            seed = ov::hash_combine(seed, output.get_partial_shape().to_string());
+            // the names are kept in an unordered set
+            const auto& names = output.get_names();
+            for (const auto& name : std::set<std::string>(names.begin(), names.end()))
+                seed = ov::hash_combine(seed, name);
+            seed = hash_rt_info(output.get_rt_info(), seed);
+        }
+
+        HashVisitor visitor(seed);
+        // the visitor doesn't change the attributes
+        OPENVINO_ASSERT(std::const_pointer_cast<ov::Node>(op)->visit_attributes(visitor),
+                        "Can't visit the attributes of ",
+                        op);
+        seed = visitor.get_hash();
+    }
+    return seed;
+}
+
 }  // namespace
 
 namespace ov {
@@ -84,29 +403,19 @@ std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& mod
     OPENVINO_ASSERT(model);
 
     uint64_t seed = 0;
-    // 1. Calculate hash on function
+    // 1. Calculate hash on function, the graph is walked directly instead of the serialization to keep the lookup
+    // cost proportional to the graph size
     ov::pass::Manager m;
     m.register_pass<ov::pass::FixRtInfo>();
-    m.register_pass<ov::pass::Hash>(seed);
     m.run_passes(std::const_pointer_cast<ov::Model>(model));
+    seed = hash_model(*model, seed);
 
-    // 2. Compute hash on serialized data and options
+    // 2. Compute hash on options
     for (const auto& kvp : compileOptions) {
         seed = ov::hash_combine(seed, kvp.first + kvp.second.as<std::string>());
     }
 
-    // 3. Add runtime information which may not be serialized
-    for (const auto& op : model->get_ordered_ops()) {
-        const auto& rt = op->get_rt_info();
-        for (const auto& rtMapData : rt) {
-            seed = ov::hash_combine(seed, rtMapData.first);
-            std::stringstream strm;
-            rtMapData.second.print(strm);
-            seed = ov::hash_combine(seed, strm.str());
-        }
-    }
-
-    // 4. Legacy part if CNNNetwork is used with new Plugin API
+    // 3. Legacy part if CNNNetwork is used with new Plugin API
     for (auto&& input : model->inputs()) {
         auto& rt_info = input.get_rt_info();
 
@@ -4,7 +4,10 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -174,6 +177,13 @@ struct CPUStreamsExecutor::Impl {
                                ? _impl->_config._stream_core_ids[stream_id]
                                : _cpu_ids;
                 if (_cpu_ids.size() > 0) {
+                    // the processors are reserved regardless of the numa nodes assignment of the streams, so the
+                    // node is taken from the pinned processors to let the stream use the node local data
+                    const auto numa_node_id = get_numa_node_id(_cpu_ids);
+                    const auto numa_nodes = get_available_numa_nodes();
+                    if (std::find(numa_nodes.begin(), numa_nodes.end(), numa_node_id) != numa_nodes.end()) {
+                        _numaNodeId = numa_node_id;
+                    }
                     CpuSet processMask;
                     int ncpus = 0;
                     std::tie(processMask, ncpus) = get_process_mask();
@@ -357,23 +367,28 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _taskQueues.emplace_back(new TaskQueue);
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                for (;;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
+                    if (Pop(streamId, task)) {
                         Execute(task, *(_streams.local()));
+                        continue;
+                    }
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    // the counter is incremented before the pending tasks are checked, so Enqueue either sees the
+                    // sleeping thread and notifies it or the thread sees the enqueued task
+                    ++_sleepingThreads;
+                    _queueCondVar.wait(lock, [&] {
+                        return _pendingTasks > 0 || _isStopped;
+                    });
+                    --_sleepingThreads;
+                    if (_pendingTasks == 0 && _isStopped) {
+                        break;
                     }
                 }
             });
@@ -381,11 +396,39 @@ struct CPUStreamsExecutor::Impl {
     }
 
     void Enqueue(Task task) {
+        // the tasks are spread over the per stream queues, so the producers and the streams don't contend on a
+        // single lock, the idle streams steal the tasks from the others
+        auto& queue = *_taskQueues[_nextQueue++ % _taskQueues.size()];
         {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            queue._tasks.emplace_back(std::move(task));
+            ++_pendingTasks;
+        }
+        if (_sleepingThreads > 0) {
+            // waits for the thread which is going to sleep to start waiting, so the notification isn't lost
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+            }
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
+    }
+
+    /**
+     * Takes a task from the own queue of the stream thread or steals it from the queues of the other streams
+     */
+    bool Pop(int streamId, Task& task) {
+        const auto queuesNum = _taskQueues.size();
+        for (std::size_t i = 0; i < queuesNum; ++i) {
+            auto& queue = *_taskQueues[(streamId + i) % queuesNum];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            if (!queue._tasks.empty()) {
+                task = std::move(queue._tasks.front());
+                queue._tasks.pop_front();
+                --_pendingTasks;
+                return true;
+            }
+        }
+        return false;
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -425,7 +468,14 @@ struct CPUStreamsExecutor::Impl {
     std::mutex _mutex;
     std::mutex _cpumap_mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    struct TaskQueue {
+        std::mutex _mutex;
+        std::deque<Task> _tasks;
+    };
+    std::vector<std::unique_ptr<TaskQueue>> _taskQueues;
+    std::atomic<std::size_t> _nextQueue{0};
+    std::atomic<std::size_t> _pendingTasks{0};
+    std::atomic<int> _sleepingThreads{0};
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
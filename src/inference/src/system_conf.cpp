@@ -4,6 +4,7 @@
 
 #include "openvino/runtime/system_conf.hpp"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
@@ -190,6 +191,9 @@ std::vector<std::vector<int>> reserve_available_cpus(const std::vector<std::vect
     return {{-1}};
 }
 void set_cpu_used(const std::vector<int>& cpu_ids, const int used) {}
+int get_numa_node_id(const std::vector<int>& cpu_ids) {
+    return -1;
+}
 
 #elif defined(__APPLE__)
 // for Linux and Windows the getNumberOfCPUCores (that accounts only for physical cores) implementation is OS-specific
@@ -224,6 +228,9 @@ std::vector<std::vector<int>> reserve_available_cpus(const std::vector<std::vect
     return {{-1}};
 }
 void set_cpu_used(const std::vector<int>& cpu_ids, const int used) {}
+int get_numa_node_id(const std::vector<int>& cpu_ids) {
+    return -1;
+}
 
 #else
 
@@ -357,6 +364,23 @@ void set_cpu_used(const std::vector<int>& cpu_ids, const int used) {
     }
 }
 
+int get_numa_node_id(const std::vector<int>& cpu_ids) {
+    CPU& cpu = cpu_info();
+    std::lock_guard<std::mutex> lock{cpu._cpu_mutex};
+    std::map<int, int> cpus_per_node;
+    for (const auto cpu_id : cpu_ids) {
+        if (cpu_id >= 0 && cpu_id < cpu._processors) {
+            cpus_per_node[cpu._cpu_mapping_table[cpu_id][CPU_MAP_NUMA_NODE_ID]]++;
+        }
+    }
+    const auto node = std::max_element(cpus_per_node.begin(),
+                                       cpus_per_node.end(),
+                                       [](const std::pair<const int, int>& a, const std::pair<const int, int>& b) {
+                                           return a.second < b.second;
+                                       });
+    return node == cpus_per_node.end() ? -1 : node->first;
+}
+
 int get_number_of_logical_cpu_cores(bool bigCoresOnly) {
     int logical_cores = parallel_get_max_threads();
 #    if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
@@ -5,8 +5,11 @@
 #include <gtest/gtest.h>
 #include <ie_system_conf.h>
 
+#include <algorithm>
+#include <chrono>
 #include <future>
 #include <ie_parallel.hpp>
+#include <iostream>
 #include <thread>
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
@@ -214,6 +217,50 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+// Microbenchmark of the task queues of the streams executor, is run manually with --gtest_also_run_disabled_tests
+TEST(CPUStreamsExecutorPerfTest, DISABLED_tasksThroughputAndLatency) {
+    using Clock = std::chrono::steady_clock;
+    constexpr int PRODUCERS_NUMBER = 4;
+    constexpr int TASKS_PER_PRODUCER = 25000;
+    for (int streams = 1; streams <= 128; streams *= 2) {
+        auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{
+            "TestCPUStreamsExecutor", streams, 1, IStreamsExecutor::ThreadBindingType::NONE});
+        std::vector<std::vector<Clock::duration>> latencies(PRODUCERS_NUMBER,
+                                                            std::vector<Clock::duration>(TASKS_PER_PRODUCER));
+        std::atomic_int done = {0};
+        const auto start = Clock::now();
+        std::vector<std::thread> producers;
+        for (int p = 0; p < PRODUCERS_NUMBER; p++) {
+            producers.emplace_back([&, p] {
+                for (int t = 0; t < TASKS_PER_PRODUCER; t++) {
+                    const auto enqueued = Clock::now();
+                    taskExecutor->run([&, p, t, enqueued] {
+                        latencies[p][t] = Clock::now() - enqueued;
+                        ++done;
+                    });
+                }
+            });
+        }
+        for (auto&& producer : producers)
+            producer.join();
+        while (done < PRODUCERS_NUMBER * TASKS_PER_PRODUCER)
+            std::this_thread::yield();
+        const auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+        std::vector<Clock::duration> all;
+        for (auto&& producerLatencies : latencies)
+            all.insert(all.end(), producerLatencies.begin(), producerLatencies.end());
+        std::sort(all.begin(), all.end());
+        auto percentile = [&](double p) {
+            return std::chrono::duration_cast<std::chrono::microseconds>(all[static_cast<size_t>(p * (all.size() - 1))])
+                .count();
+        };
+        std::cout << "streams: " << streams << ", tasks/sec: " << static_cast<int64_t>(all.size() / elapsed)
+                  << ", latency p50: " << percentile(0.5) << "us, p99: " << percentile(0.99)
+                  << "us, p99.9: " << percentile(0.999) << "us" << std::endl;
+    }
+}
+
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
 static auto Executors = ::testing::Values(
@@ -6,6 +6,7 @@
 
 #include <chrono>
 #include <fstream>
+#include <set>
 #include <string>
 #include <thread>
 
@@ -301,6 +302,103 @@ TEST(NetworkContext, HashWithDifferentResults) {
     ASSERT_EQ(ModelCache::compute_hash(net2, {}), ModelCache::compute_hash(net3, {}));
 }
 
+TEST(NetworkContext, HashWithConstantData) {
+    // the constant is hashed by several chunks
+    auto create_function = [](int8_t last_value) {
+        std::vector<int8_t> values((2 << 20) + 3, 1);
+        values.back() = last_value;
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::i8, ngraph::Shape{values.size()});
+        auto constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{values.size()}, values);
+        auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+        auto res = std::make_shared<ngraph::opset6::Result>(add);
+        return std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data});
+    };
+    auto net1 = create_function(1);
+    auto net2 = create_function(1);
+    auto net3 = create_function(2);
+    ASSERT_EQ(ModelCache::compute_hash(net1, {}), ModelCache::compute_hash(net2, {}));
+    ASSERT_NE(ModelCache::compute_hash(net2, {}), ModelCache::compute_hash(net3, {}));
+}
+
+TEST(NetworkContext, HashWithAttributes) {
+    // the rounding type doesn't change the output shape here, so only the attribute differs
+    auto create_function = [](ngraph::op::RoundingType rounding_type) {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 8, 8});
+        auto pool = std::make_shared<ngraph::opset6::MaxPool>(data,
+                                                              ngraph::Strides{1, 1},
+                                                              ngraph::Shape{0, 0},
+                                                              ngraph::Shape{0, 0},
+                                                              ngraph::Shape{2, 2},
+                                                              rounding_type);
+        auto res = std::make_shared<ngraph::opset6::Result>(pool);
+        return std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data});
+    };
+    auto net1 = create_function(ngraph::op::RoundingType::FLOOR);
+    auto net2 = create_function(ngraph::op::RoundingType::FLOOR);
+    auto net3 = create_function(ngraph::op::RoundingType::CEIL);
+    ASSERT_EQ(ModelCache::compute_hash(net1, {}), ModelCache::compute_hash(net2, {}));
+    ASSERT_NE(ModelCache::compute_hash(net2, {}), ModelCache::compute_hash(net3, {}));
+}
+
+struct UnsupportedAttribute {};
+
+namespace ov {
+template <>
+class AttributeAdapter<UnsupportedAttribute> : public DirectValueAccessor<UnsupportedAttribute> {
+public:
+    AttributeAdapter(UnsupportedAttribute& value) : DirectValueAccessor<UnsupportedAttribute>(value) {}
+    OPENVINO_RTTI("AttributeAdapter<UnsupportedAttribute>");
+};
+}  // namespace ov
+
+template <class T>
+class AttributeOp : public ov::op::Op {
+public:
+    OPENVINO_OP("AttributeOp");
+
+    AttributeOp(const ov::Output<ov::Node>& arg, const T& value) : Op({arg}), m_value(value) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        return std::make_shared<AttributeOp>(new_args.at(0), m_value);
+    }
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override {
+        visitor.on_attribute("value", m_value);
+        return true;
+    }
+
+private:
+    T m_value;
+};
+
+template <class T>
+static std::shared_ptr<ngraph::Function> create_attribute_function(const T& value) {
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+    auto op = std::make_shared<AttributeOp<T>>(data, value);
+    auto res = std::make_shared<ngraph::opset6::Result>(op);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data});
+}
+
+TEST(NetworkContext, HashWithStringSetAttribute) {
+    auto net1 = create_attribute_function(std::set<std::string>{"a", "b"});
+    auto net2 = create_attribute_function(std::set<std::string>{"a", "b"});
+    auto net3 = create_attribute_function(std::set<std::string>{"a", "c"});
+    ASSERT_EQ(ModelCache::compute_hash(net1, {}), ModelCache::compute_hash(net2, {}));
+    ASSERT_NE(ModelCache::compute_hash(net2, {}), ModelCache::compute_hash(net3, {}));
+}
+
+TEST(NetworkContext, HashWithUnsupportedAttribute) {
+    // the value can't be hashed, so the model can't be cached like it couldn't be serialized
+    auto net = create_attribute_function(UnsupportedAttribute{});
+    ASSERT_THROW(ModelCache::compute_hash(net, {}), ov::Exception);
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext, HashOfSameMultiThreading) {
     auto net1 = create_simple_function();
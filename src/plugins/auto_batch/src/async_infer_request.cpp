@@ -26,7 +26,13 @@ AsyncInferRequest::AsyncInferRequest(const SyncInferRequest::Ptr& inferRequest,
             workerInferRequest._tasks.push(t);
             // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
             const int sz = static_cast<int>(workerInferRequest._tasks.size());
-            if (sz == workerInferRequest._batchSize) {
+            workerInferRequest._timings.OnArrival(sz == 1);
+            if (sz == workerInferRequest._batchSize || (sz == 1 && workerInferRequest._adaptiveTimeout)) {
+                // the idle adaptive worker waits for the max timeout, so the wake up must not be lost between
+                // the picking of its timeout (under the mutex) and the wait
+                if (workerInferRequest._adaptiveTimeout) {
+                    std::lock_guard<std::mutex> lock(workerInferRequest._mutex);
+                }
                 workerInferRequest._cond.notify_one();
             }
         };
@@ -48,10 +54,15 @@ AsyncInferRequest::AsyncInferRequest(const SyncInferRequest::Ptr& inferRequest,
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> AsyncInferRequest::GetPerformanceCounts() const {
     CheckState();
-    if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_infer_request->m_batched_request_status)
-        return m_sync_infer_request->m_batched_request_wrapper._inferRequestBatched->GetPerformanceCounts();
-    else
+    auto& batchReq = m_sync_infer_request->m_batched_request_wrapper;
+    switch (m_sync_infer_request->m_batched_request_status) {
+    case SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED:
+        return batchReq._inferRequestBatched->GetPerformanceCounts();
+    case SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED:
+        return batchReq._partialBatchRequests.at(m_sync_infer_request->m_partial_batch_size)->GetPerformanceCounts();
+    default:
         return m_infer_request_without_batch->GetPerformanceCounts();
+    }
 }
 
 void AsyncInferRequest::Infer_ThreadUnsafe() {
@@ -11,16 +11,70 @@
 
 namespace ov {
 namespace autobatch_plugin {
+void BatchTimings::Accumulate(Duration& average, Duration sample) {
+    // exponential moving average, so the estimations follow the changes of the load
+    constexpr double weight = 0.125;
+    average = average.count() > 0 ? average + (sample - average) * weight : sample;
+}
+
+void BatchTimings::OnArrival(bool first) {
+    const auto now = Clock::now();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_last_arrival != Clock::time_point{})
+        Accumulate(m_inter_arrival, now - m_last_arrival);
+    m_last_arrival = now;
+    if (first)
+        m_first_arrival = now;
+}
+
+void BatchTimings::OnCollected(bool remaining) {
+    if (remaining) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_first_arrival = Clock::now();
+    }
+}
+
+void BatchTimings::OnBatchExecuted(Duration latency) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Accumulate(m_batch_latency, latency);
+}
+
+void BatchTimings::OnBatch1Executed(Duration latency) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Accumulate(m_batch1_latency, latency);
+}
+
+std::chrono::milliseconds BatchTimings::GetTimeout(int collected,
+                                                   int batchSize,
+                                                   std::chrono::milliseconds latencySlo,
+                                                   std::chrono::milliseconds maxTimeout) const {
+    // the idle worker is woken up by the first arrival, so there is no deadline to meet yet
+    // (the zero budget of the unreachable objective would make it spin without the traffic)
+    if (collected == 0)
+        return maxTimeout;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // the oldest request must be done by the deadline either with the batch or after the fallback to the batch1
+    const auto execution = std::max(m_batch_latency, m_batch1_latency);
+    const Duration budget = latencySlo - execution - (Clock::now() - m_first_arrival);
+    // the rest of the batch is not expected to arrive in time, so waiting just adds the latency
+    if (m_inter_arrival * (batchSize - collected) > budget)
+        return std::chrono::milliseconds(0);
+    const auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(std::max(budget, Duration(0)));
+    return std::min(timeout, maxTimeout);
+}
+
 CompiledModel::CompiledModel(const InferenceEngine::SoExecutableNetworkInternal& networkWithBatch,
                              const InferenceEngine::SoExecutableNetworkInternal& networkWithoutBatch,
                              const DeviceInformation& networkDevice,
                              const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
                              const std::set<std::string>& batchedInputs,
-                             const std::set<std::string>& batchedOutputs)
+                             const std::set<std::string>& batchedOutputs,
+                             const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& partialBatchNetworks)
     : InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr,
                                                           std::make_shared<InferenceEngine::ImmediateExecutor>()),
       m_model_with_batch{networkWithBatch},
       m_model_without_batch{networkWithoutBatch},
+      m_models_partial_batch{partialBatchNetworks},
       m_config{config},
       m_batched_inputs(batchedInputs),
       m_batched_outputs(batchedOutputs) {
@@ -29,6 +83,9 @@ CompiledModel::CompiledModel(const InferenceEngine::SoExecutableNetworkInternal&
     auto time_out = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
     IE_ASSERT(time_out != config.end());
     m_timeout = ParseTimeoutValue(time_out->second.as<std::string>());
+    auto latency_slo = config.find(auto_batch_latency_slo.name());
+    if (latency_slo != config.end())
+        m_latency_slo = ParseTimeoutValue(latency_slo->second.as<std::string>());
 }
 
 CompiledModel::~CompiledModel() {
@@ -88,10 +145,16 @@ std::pair<CompiledModel::WorkerInferRequest&, int> CompiledModel::GetWorkerInfer
         workerRequestPtr->_inferRequestBatched = {m_model_with_batch->CreateInferRequest(), m_model_with_batch._so};
         workerRequestPtr->_batchSize = m_device_info.batch_for_device;
         workerRequestPtr->_completionTasks.resize(workerRequestPtr->_batchSize);
+        workerRequestPtr->_adaptiveTimeout = m_latency_slo != 0;
+        for (const auto& model : m_models_partial_batch)
+            workerRequestPtr->_partialBatchRequests[model.first] = {model.second->CreateInferRequest(),
+                                                                    model.second._so};
         workerRequestPtr->_inferRequestBatched->SetCallback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->m_exceptionPtr = exceptionPtr;
+                workerRequestPtr->_timings.OnBatchExecuted(BatchTimings::Clock::now() -
+                                                           workerRequestPtr->_batchStart);
                 IE_ASSERT(workerRequestPtr->_completionTasks.size() == (size_t)workerRequestPtr->_batchSize);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batchSize; c++) {
@@ -106,7 +169,7 @@ std::pair<CompiledModel::WorkerInferRequest&, int> CompiledModel::GetWorkerInfer
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_timeout));
+                    status = workerRequestPtr->_cond.wait_for(lock, GetBatchCollectionTimeout(*workerRequestPtr));
                 }
                 if (m_terminate) {
                     break;
@@ -123,7 +186,18 @@ std::pair<CompiledModel::WorkerInferRequest&, int> CompiledModel::GetWorkerInfer
                             t.first->m_sync_infer_request->m_batched_request_status =
                                 SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_timings.OnCollected(workerRequestPtr->_tasks.size() != 0);
+                        m_batches_executed++;
+                        m_batched_requests += sz;
+                        workerRequestPtr->_batchStart = BatchTimings::Clock::now();
                         workerRequestPtr->_inferRequestBatched->StartAsync();
+                    } else if ((status == std::cv_status::timeout) && sz &&
+                               workerRequestPtr->_partialBatchRequests.lower_bound(sz) !=
+                                   workerRequestPtr->_partialBatchRequests.end()) {
+                        // timeout to collect the batch is over, execute the requests as the closest partial batch
+                        ExecutePartialBatch(*workerRequestPtr,
+                                            workerRequestPtr->_partialBatchRequests.lower_bound(sz)->first,
+                                            sz);
                     } else if ((status == std::cv_status::timeout) && sz) {
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
                         std::pair<AsyncInferRequest*, InferenceEngine::Task> t;
@@ -131,6 +205,9 @@ std::pair<CompiledModel::WorkerInferRequest&, int> CompiledModel::GetWorkerInfer
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
+                        const auto start = BatchTimings::Clock::now();
+                        m_timeouts++;
+                        m_timed_out_requests += sz;
                         for (int n = 0; n < sz; n++) {
                             IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             t.first->m_infer_request_without_batch->SetCallback(
@@ -147,7 +224,9 @@ std::pair<CompiledModel::WorkerInferRequest&, int> CompiledModel::GetWorkerInfer
                                 t.first->m_infer_request_without_batch);
                             t.first->m_infer_request_without_batch->StartAsync();
                         }
+                        workerRequestPtr->_timings.OnCollected(workerRequestPtr->_tasks.size() != 0);
                         all_completed_future.get();
+                        workerRequestPtr->_timings.OnBatch1Executed(BatchTimings::Clock::now() - start);
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -157,6 +236,61 @@ std::pair<CompiledModel::WorkerInferRequest&, int> CompiledModel::GetWorkerInfer
     return {*m_worker_requests.back(), static_cast<int>(batch_id)};
 }
 
+void CompiledModel::ExecutePartialBatch(WorkerInferRequest& worker, int size, int collected) {
+    auto& request = worker._partialBatchRequests.at(size);
+    std::vector<std::pair<AsyncInferRequest*, InferenceEngine::Task>> tasks(collected);
+    for (int n = 0; n < collected; n++) {
+        IE_ASSERT(worker._tasks.try_pop(tasks[n]));
+        // the slices of the partial batch beyond the collected requests keep the stale data, their results are dropped
+        tasks[n].first->m_sync_infer_request->CopyInputsToPartialBatch(request, n, size);
+        tasks[n].first->m_sync_infer_request->m_batched_request_status =
+            SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+        tasks[n].first->m_sync_infer_request->m_partial_batch_size = size;
+    }
+    worker._timings.OnCollected(worker._tasks.size() != 0);
+    m_partial_batches++;
+    m_timeouts++;
+    m_timed_out_requests += collected;
+
+    std::promise<void> completed;
+    auto completed_future = completed.get_future();
+    const auto start = BatchTimings::Clock::now();
+    auto complete = [&tasks, &request, &completed, size](std::exception_ptr p) {
+        for (size_t n = 0; n < tasks.size(); n++) {
+            auto& syncRequest = tasks[n].first->m_sync_infer_request;
+            try {
+                if (p)
+                    std::rethrow_exception(p);
+                syncRequest->CopyOutputsFromPartialBatch(request, n, size);
+            } catch (...) {
+                syncRequest->m_exceptionPtr = std::current_exception();
+            }
+            tasks[n].second();
+        }
+        completed.set_value();
+    };
+    try {
+        request->SetCallback(complete);
+        request->StartAsync();
+    } catch (...) {
+        complete(std::current_exception());
+    }
+    completed_future.get();
+    // the partial batch is executed instead of the batch1 fallback, so it bounds the fallback latency
+    worker._timings.OnBatch1Executed(BatchTimings::Clock::now() - start);
+}
+
+std::chrono::milliseconds CompiledModel::GetBatchCollectionTimeout(WorkerInferRequest& worker) const {
+    const auto timeout = std::chrono::milliseconds(m_timeout);
+    if (!worker._adaptiveTimeout)
+        return timeout;
+    // as we pop the tasks from the queue only in the worker thread, the size can only grow in parallel
+    return worker._timings.GetTimeout(static_cast<int>(worker._tasks.size()),
+                                      worker._batchSize,
+                                      std::chrono::milliseconds(m_latency_slo),
+                                      timeout);
+}
+
 InferenceEngine::IInferRequestInternal::Ptr CompiledModel::CreateInferRequest() {
     if (!m_model_with_batch) {
         auto res = m_model_without_batch->CreateInferRequest();
@@ -232,12 +366,24 @@ InferenceEngine::Parameter CompiledModel::GetMetric(const std::string& name) con
                               METRIC_KEY(SUPPORTED_METRICS),
                               METRIC_KEY(NETWORK_NAME),
                               METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-                              ov::execution_devices.name()});
+                              ov::execution_devices.name(),
+                              auto_batch_statistics.name()});
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS,
                              {CONFIG_KEY(AUTO_BATCH_TIMEOUT)});  // only timeout can be changed on the fly
     } else if (name == ov::execution_devices) {
         return m_model_without_batch->GetMetric(name);
+    } else if (name == auto_batch_statistics) {
+        const uint64_t batched = m_batched_requests;
+        const uint64_t timed_out = m_timed_out_requests;
+        const uint64_t total = batched + timed_out;
+        return decltype(auto_batch_statistics)::value_type{
+            {"batches", static_cast<uint64_t>(m_batches_executed)},
+            {"timeouts", static_cast<uint64_t>(m_timeouts)},
+            {"batched_requests", batched},
+            {"timed_out_requests", timed_out},
+            {"partial_batches", static_cast<uint64_t>(m_partial_batches)},
+            {"fill_rate", total ? batched * 100 / total : 0}};
     } else {
         IE_THROW() << "Unsupported Network metric: " << name;
     }
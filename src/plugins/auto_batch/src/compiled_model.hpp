@@ -5,6 +5,7 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <chrono>
 #include <map>
 
 #include "cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp"
@@ -17,6 +18,41 @@ namespace autobatch_plugin {
 
 class AsyncInferRequest;
 
+// Tracks the requests arrival rate and the execution latencies of a worker to pick the batch collection timeout
+class BatchTimings {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Duration = std::chrono::duration<double, std::milli>;
+
+    // called on every request pushed to the worker's queue, the first one starts the batch collection
+    void OnArrival(bool first);
+    // called when the worker pops the requests, the remaining ones (if any) start the next batch collection
+    void OnCollected(bool remaining);
+    void OnBatchExecuted(Duration latency);
+    void OnBatch1Executed(Duration latency);
+
+    /**
+     * @brief Picks the time to wait for the rest of the batch, so the oldest collected request fits the latency
+     * objective. The wait is 0 when the batch is not expected to be filled in time and maxTimeout when nothing is
+     * collected yet.
+     */
+    std::chrono::milliseconds GetTimeout(int collected,
+                                         int batchSize,
+                                         std::chrono::milliseconds latencySlo,
+                                         std::chrono::milliseconds maxTimeout) const;
+
+    // moving averages, 0 until the first sample
+    Duration m_inter_arrival{0};
+    Duration m_batch_latency{0};
+    Duration m_batch1_latency{0};
+    Clock::time_point m_last_arrival;
+    Clock::time_point m_first_arrival;
+
+protected:
+    static void Accumulate(Duration& average, Duration sample);
+    mutable std::mutex m_mutex;
+};
+
 class CompiledModel : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
     using Ptr = std::shared_ptr<CompiledModel>;
@@ -30,6 +66,12 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr m_exceptionPtr;
+        // the worker is woken up on the first request of a batch to track the collection time
+        bool _adaptiveTimeout = false;
+        BatchTimings _timings;
+        BatchTimings::Clock::time_point _batchStart;
+        // requests of the partial batch networks by the batch size
+        std::map<int, InferenceEngine::SoIInferRequestInternal> _partialBatchRequests;
     };
 
     CompiledModel(const InferenceEngine::SoExecutableNetworkInternal& networkForDevice,
@@ -37,7 +79,8 @@ public:
                   const DeviceInformation& networkDevices,
                   const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
                   const std::set<std::string>& batchedIntputs,
-                  const std::set<std::string>& batchedOutputs);
+                  const std::set<std::string>& batchedOutputs,
+                  const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& partialBatchNetworks = {});
 
     void SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) override;
 
@@ -67,14 +110,26 @@ protected:
     DeviceInformation m_device_info;
     InferenceEngine::SoExecutableNetworkInternal m_model_with_batch;
     InferenceEngine::SoExecutableNetworkInternal m_model_without_batch;
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> m_models_partial_batch;
 
     std::pair<WorkerInferRequest&, int> GetWorkerInferRequest();
+    std::chrono::milliseconds GetBatchCollectionTimeout(WorkerInferRequest& worker) const;
+    // executes the requests collected by the timeout as the partial batch of the given size
+    void ExecutePartialBatch(WorkerInferRequest& worker, int size, int collected);
     std::vector<WorkerInferRequest::Ptr> m_worker_requests;
     std::mutex m_worker_requests_mutex;
 
     std::unordered_map<std::string, InferenceEngine::Parameter> m_config;
     std::atomic_size_t m_num_requests_created = {0};
     std::atomic_int m_timeout = {0};  // in ms
+    unsigned int m_latency_slo = 0;   // in ms, 0 if the adaptive timeout is disabled
+
+    // batch collection statistics
+    std::atomic_size_t m_batches_executed = {0};
+    std::atomic_size_t m_timeouts = {0};
+    std::atomic_size_t m_batched_requests = {0};
+    std::atomic_size_t m_timed_out_requests = {0};
+    std::atomic_size_t m_partial_batches = {0};
 
     const std::set<std::string> m_batched_inputs;
     const std::set<std::string> m_batched_outputs;
@@ -25,7 +25,9 @@ namespace autobatch_plugin {
 std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
                                                  ov::device::priorities.name(),
                                                  CONFIG_KEY(AUTO_BATCH_TIMEOUT),
-                                                 CONFIG_KEY(CACHE_DIR)};
+                                                 CONFIG_KEY(CACHE_DIR),
+                                                 auto_batch_latency_slo.name(),
+                                                 auto_batch_partial_batches.name()};
 namespace {
 
 std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
@@ -111,15 +113,17 @@ void Plugin::CheckConfig(const std::map<std::string, std::string>& user_config)
             IE_THROW() << "Unsupported config key: " << name;
         if (name == CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) || name == ov::device::priorities.name()) {
             ParseBatchDevice(val);
-        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT)) {
+        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT) || name == auto_batch_latency_slo.name()) {
             try {
                 auto t = std::stoi(val);
                 if (t < 0)
                     IE_THROW(ParameterMismatch);
             } catch (const std::exception&) {
-                IE_THROW(ParameterMismatch)
-                    << " Expecting unsigned int value for " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " got " << val;
+                IE_THROW(ParameterMismatch) << " Expecting unsigned int value for " << name << " got " << val;
             }
+        } else if (name == auto_batch_partial_batches.name()) {
+            if (val != CONFIG_VALUE(YES) && val != CONFIG_VALUE(NO))
+                IE_THROW(ParameterMismatch) << " Expecting YES/NO value for " << name << " got " << val;
         }
     }
 }
@@ -137,6 +141,8 @@ IE_DEFINE_PLUGIN_CREATE_FUNCTION(Plugin, version)
 Plugin::Plugin() {
     _pluginName = "BATCH";
     _config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = "1000";  // default value, in ms
+    _config[auto_batch_latency_slo.name()] = "0";       // adaptive timeout is disabled by default
+    _config[auto_batch_partial_batches.name()] = CONFIG_VALUE(NO);
 }
 
 InferenceEngine::Parameter Plugin::GetMetric(
@@ -324,12 +330,31 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Plugin::LoadNetworkImpl(
         }
     }
 
+    // the networks to execute the requests collected by the timeout, as batch1 is the fallback the ladder starts at 2
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> partialBatchNetworks;
+    if (executableNetworkWithBatch && fullConfig[auto_batch_partial_batches.name()] == CONFIG_VALUE(YES)) {
+        for (int batch = 2; batch < metaDevice.batch_for_device; batch *= 2) {
+            try {
+                InferenceEngine::CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
+                InferenceEngine::ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
+                for (const auto& input : batched_inputs)
+                    shapes[input][0] = batch;
+                reshaped.reshape(shapes);
+                partialBatchNetworks[batch] = ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
+                                                  : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+            } catch (const InferenceEngine::Exception&) {
+                // the closest bigger batch (or batch1) is used for this size then
+            }
+        }
+    }
+
     return std::make_shared<CompiledModel>(executableNetworkWithBatch,
                                            executableNetworkWithoutBatch,
                                            metaDevice,
                                            networkConfig,
                                            batched_inputs,
-                                           batched_outputs);
+                                           batched_outputs,
+                                           partialBatchNetworks);
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr Plugin::LoadExeNetworkImpl(
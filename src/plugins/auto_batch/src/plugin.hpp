@@ -9,6 +9,7 @@
 
 #include "cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp"
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
+#include "openvino/runtime/properties.hpp"
 
 #ifdef AUTOBATCH_UNITTEST
 #    define autobatch_plugin mock_autobatch_plugin
@@ -17,6 +18,29 @@
 namespace ov {
 namespace autobatch_plugin {
 
+/**
+ * @brief Latency objective (in ms) of a request for the adaptive batch collection.
+ *
+ * The time to wait for the rest of the batch is picked per batch from the observed requests arrival rate and the
+ * batched execution latency, while the AUTO_BATCH_TIMEOUT stays an upper bound. 0 (default) keeps the fixed timeout.
+ */
+static constexpr ov::Property<uint32_t> auto_batch_latency_slo{"AUTO_BATCH_LATENCY_SLO"};
+
+/**
+ * @brief Read-only batch collection statistics of a compiled model: the numbers of the executed "batches", the
+ * "timeouts", the requests executed within the batches ("batched_requests") and after the timeouts
+ * ("timed_out_requests"), the timeouts handled by the partial batches ("partial_batches") and the percentage of the
+ * batched requests ("fill_rate").
+ */
+static constexpr ov::Property<std::map<std::string, uint64_t>, ov::PropertyMutability::RO> auto_batch_statistics{
+    "AUTO_BATCH_STATISTICS"};
+
+/**
+ * @brief Enables compilation of the networks for the partial batches (powers of 2 below the device batch), so the
+ * requests collected by the moment of the timeout are executed as the closest partial batch instead of one by one.
+ */
+static constexpr ov::Property<bool> auto_batch_partial_batches{"AUTO_BATCH_PARTIAL_BATCHES"};
+
 struct DeviceInformation {
     std::string device_name;
     std::map<std::string, std::string> config;
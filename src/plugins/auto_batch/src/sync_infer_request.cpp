@@ -175,6 +175,7 @@ void SyncInferRequest::ShareBlobsWithBatchRequest(const std::set<std::string>& b
             IE_THROW() << "Unsupported input precision " << it.second->getTensorDesc().getPrecision();
         }
         _inputs[it.first] = res;
+        m_batched_input_views[it.first] = res;
     }
     // Allocate all output blobs
     for (const auto& it : _networkOutputs) {
@@ -289,6 +290,7 @@ void SyncInferRequest::ShareBlobsWithBatchRequest(const std::set<std::string>& b
             IE_THROW(NotImplemented) << "Unsupported input precision " << it.second->getTensorDesc().getPrecision();
         }
         _outputs[it.first] = res;
+        m_batched_output_views[it.first] = res;
     }
 }
 void SyncInferRequest::SetBlobsToAnotherRequest(InferenceEngine::SoIInferRequestInternal& req) {
@@ -312,11 +314,24 @@ void SyncInferRequest::CopyInputsIfNeeded() {
     for (const auto& it : _networkInputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(GetBlob(name), m_batched_request_wrapper._inferRequestBatched->GetBlob(name), true);
+        auto blob = GetBlob(name);
+        // the blob is still the view into the batched blob, so the data is already in place
+        // (checked before locking the buffers as locking a device blob may be costly)
+        if (blob == m_batched_input_views[name])
+            continue;
+        CopyBlobIfNeeded(blob,
+                         m_batched_request_wrapper._inferRequestBatched->GetBlob(name),
+                         true,
+                         m_batch_id,
+                         m_batch_size);
     }
 }
 
-void SyncInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, InferenceEngine::Blob::Ptr dst, bool bInput) {
+void SyncInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
+                                        InferenceEngine::Blob::Ptr dst,
+                                        bool bInput,
+                                        size_t batch_id,
+                                        size_t batch_size) {
     auto bufferDst = dst->buffer();
     auto ptrDst = bufferDst.as<char*>();
     auto bufferSrc = src->cbuffer();
@@ -324,13 +339,13 @@ void SyncInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, Inferen
     ptrdiff_t szDst = dst->byteSize();
     ptrdiff_t szSrc = src->byteSize();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? m_batch_id * szDst / m_batch_size : 0;
+        ptrdiff_t offset = szSrc != szDst ? batch_id * szDst / batch_size : 0;
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
             memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
-        ptrdiff_t offset = szSrc != szDst ? m_batch_id * szSrc / m_batch_size : 0;
+        ptrdiff_t offset = szSrc != szDst ? batch_id * szSrc / batch_size : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
@@ -342,7 +357,34 @@ void SyncInferRequest::CopyOutputsIfNeeded() {
     for (const auto& it : _networkOutputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(m_batched_request_wrapper._inferRequestBatched->GetBlob(name), GetBlob(name), false);
+        auto blob = GetBlob(name);
+        if (blob == m_batched_output_views[name])
+            continue;
+        CopyBlobIfNeeded(m_batched_request_wrapper._inferRequestBatched->GetBlob(name),
+                         blob,
+                         false,
+                         m_batch_id,
+                         m_batch_size);
+    }
+}
+
+void SyncInferRequest::CopyInputsToPartialBatch(InferenceEngine::SoIInferRequestInternal& req,
+                                                size_t batch_id,
+                                                size_t batch_size) {
+    for (const auto& it : _networkInputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(GetBlob(name), req->GetBlob(name), true, batch_id, batch_size);
+    }
+}
+
+void SyncInferRequest::CopyOutputsFromPartialBatch(InferenceEngine::SoIInferRequestInternal& req,
+                                                   size_t batch_id,
+                                                   size_t batch_size) {
+    for (const auto& it : _networkOutputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(req->GetBlob(name), GetBlob(name), false, batch_id, batch_size);
     }
 }
 }  // namespace autobatch_plugin
@@ -37,6 +37,13 @@ public:
 
     void CopyOutputsIfNeeded();
 
+    // copies the data to/from the slice of the partial batch request
+    void CopyInputsToPartialBatch(InferenceEngine::SoIInferRequestInternal& req, size_t batch_id, size_t batch_size);
+
+    void CopyOutputsFromPartialBatch(InferenceEngine::SoIInferRequestInternal& req,
+                                     size_t batch_id,
+                                     size_t batch_size);
+
     CompiledModel::WorkerInferRequest& m_batched_request_wrapper;
 
     std::exception_ptr m_exceptionPtr;
@@ -44,17 +51,29 @@ public:
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
+        PARTIAL_BATCH_EXECUTED,
         TIMEOUT_EXECUTED
     } m_batched_request_status = eExecutionFlavor::NOT_EXECUTED;
 
+    // size of the partial batch network the request was executed by, if PARTIAL_BATCH_EXECUTED
+    int m_partial_batch_size = 0;
+
 protected:
-    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, InferenceEngine::Blob::Ptr dst, bool bInput);
+    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
+                          InferenceEngine::Blob::Ptr dst,
+                          bool bInput,
+                          size_t batch_id,
+                          size_t batch_size);
 
     void ShareBlobsWithBatchRequest(const std::set<std::string>& batchedIntputs,
                                     const std::set<std::string>& batchedOutputs);
     size_t m_batch_id;
 
     size_t m_batch_size;
+
+    // views into the slices of the batched request blobs, which are used unless the user sets own blobs
+    std::map<std::string, InferenceEngine::Blob::Ptr> m_batched_input_views;
+    std::map<std::string, InferenceEngine::Blob::Ptr> m_batched_output_views;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
\ No newline at end of file
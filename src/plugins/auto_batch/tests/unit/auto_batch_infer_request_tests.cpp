@@ -221,6 +221,35 @@ TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyBlobTestCase) {
     }
 }
 
+TEST_P(AutoBatchRequestTest, AutoBatchRequestNoCopyForSharedBlobsTestCase) {
+    int batch_size, infer_interval;
+    ngraph::element::Type_t element_type;
+    std::tie(batch_size, element_type, infer_interval) = this->GetParam();
+
+    std::vector<size_t> inputShape = {1, 3, 24, 24};
+    auto function = ngraph::builder::subgraph::makeMultiSingleConv(inputShape, element_type);
+    prepare_input(function, batch_size);
+    create_worker(batch_size);
+
+    for (int batch_id = 0; batch_id < batch_size; batch_id++) {
+        auto req = std::make_shared<SyncInferRequest>(inputs,
+                                                      outputs,
+                                                      *workerRequestPtr,
+                                                      batch_id,
+                                                      batch_size,
+                                                      batchedInputs,
+                                                      batchedOutputs);
+        autoBatchInferRequests.emplace_back(req);
+    }
+
+    // the blobs of the requests are views into the batched blobs, so the batched blobs are not even accessed
+    EXPECT_CALL(*mockInferRequestBatched, GetBlob(_)).Times(0);
+    for (auto& req : autoBatchInferRequests) {
+        EXPECT_NO_THROW(req->CopyInputsIfNeeded());
+        EXPECT_NO_THROW(req->CopyOutputsIfNeeded());
+    }
+}
+
 class AutoBatchAsyncInferRequestTest : public AutoBatchRequestTest {
 public:
     std::shared_ptr<NiceMock<MockIInferRequestInternal>> mockInferRequestWithoutBatched;
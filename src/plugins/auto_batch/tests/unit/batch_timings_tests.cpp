@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "mock_auto_batch_plugin.hpp"
+
+using namespace ov::mock_autobatch_plugin;
+using std::chrono::milliseconds;
+
+TEST(BatchTimingsTest, TimeoutIsBoundedBySloAndMaxTimeout) {
+    BatchTimings timings;
+    timings.OnArrival(true);
+    // nothing is known yet, so the whole objective may be spent on the collection
+    EXPECT_LE(timings.GetTimeout(1, 4, milliseconds(100), milliseconds(1000)), milliseconds(100));
+    EXPECT_GE(timings.GetTimeout(1, 4, milliseconds(100), milliseconds(1000)), milliseconds(90));
+    EXPECT_EQ(milliseconds(50), timings.GetTimeout(1, 4, milliseconds(100), milliseconds(50)));
+
+    // the execution latency is reserved from the objective
+    timings.OnBatchExecuted(milliseconds(30));
+    EXPECT_LE(timings.GetTimeout(1, 4, milliseconds(100), milliseconds(1000)), milliseconds(70));
+    EXPECT_GE(timings.GetTimeout(1, 4, milliseconds(100), milliseconds(1000)), milliseconds(60));
+
+    // the objective can't be met at all
+    EXPECT_EQ(milliseconds(0), timings.GetTimeout(1, 4, milliseconds(10), milliseconds(1000)));
+}
+
+TEST(BatchTimingsTest, IdleWorkerWaitsForMaxTimeout) {
+    BatchTimings timings;
+    EXPECT_EQ(milliseconds(1000), timings.GetTimeout(0, 4, milliseconds(100), milliseconds(1000)));
+
+    // the objective is below the observed latency, still the worker must not spin without the requests
+    timings.OnBatchExecuted(milliseconds(30));
+    EXPECT_EQ(milliseconds(1000), timings.GetTimeout(0, 4, milliseconds(10), milliseconds(1000)));
+}
+
+TEST(BatchTimingsTest, NoWaitWhenBatchCantBeFilledInTime) {
+    BatchTimings timings;
+    timings.OnBatchExecuted(milliseconds(10));
+    timings.m_inter_arrival = milliseconds(20);
+    timings.OnArrival(true);
+
+    // 2 more requests are expected in ~40ms, which fits the objective
+    EXPECT_GT(timings.GetTimeout(2, 4, milliseconds(100), milliseconds(1000)), milliseconds(0));
+    // 62 more requests are not expected in time
+    EXPECT_EQ(milliseconds(0), timings.GetTimeout(2, 64, milliseconds(100), milliseconds(1000)));
+}
@@ -180,6 +180,7 @@ const std::vector<ExecNetworkParams> testConfigs = {
     ExecNetworkParams{METRIC_KEY(SUPPORTED_METRICS), 0, false},
     ExecNetworkParams{METRIC_KEY(SUPPORTED_CONFIG_KEYS), 0, false},
     ExecNetworkParams{ov::execution_devices.name(), 0, false},
+    ExecNetworkParams{"AUTO_BATCH_STATISTICS", 0, false},
     // Config in autobatch
     ExecNetworkParams{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), 1, false},
     ExecNetworkParams{CONFIG_KEY(AUTO_BATCH_TIMEOUT), 1, false},
@@ -234,6 +234,16 @@ const std::vector<PluginLoadNetworkParams> testConfigs = {
                              {"GPU_DEVICE_TOTAL_MEM_SIZE", "4096000000"}},
                             {{"AUTO_BATCH_TIMEOUT", "200"}, {"AUTO_BATCH_DEVICE_CONFIG", "GPU(32)"}},
                             32},
+    // Case 1.1: the networks for the partial batches are compiled additionally
+    PluginLoadNetworkParams{{{"PERFORMANCE_HINT", "THROUGHPUT"},
+                             {"OPTIMAL_BATCH_SIZE", "16"},
+                             {"PERFORMANCE_HINT_NUM_REQUESTS", "12"},
+                             {"GPU_MEMORY_STATISTICS", "1024000"},
+                             {"GPU_DEVICE_TOTAL_MEM_SIZE", "4096000000"}},
+                            {{"AUTO_BATCH_TIMEOUT", "200"},
+                             {"AUTO_BATCH_DEVICE_CONFIG", "CPU(8)"},
+                             {"AUTO_BATCH_PARTIAL_BATCHES", "YES"}},
+                            8},
     // Case 2: CPU batch size is figured out by min of opt_batch_size and infReq_num
     //         If config contains "PERFORMANCE_HINT_NUM_REQUESTS" else get it from core->GetConfig
     PluginLoadNetworkParams{{{"PERFORMANCE_HINT", "THROUGHPUT"},
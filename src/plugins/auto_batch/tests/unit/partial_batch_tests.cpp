@@ -0,0 +1,114 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
+#include "mock_auto_batch_plugin.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iexecutable_network_internal.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iinfer_request_internal.hpp"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+using namespace ov::mock_autobatch_plugin;
+using namespace InferenceEngine;
+
+namespace {
+std::map<std::string, InferenceEngineProfileInfo> make_perf_counts(const std::string& name) {
+    InferenceEngineProfileInfo info = {};
+    info.status = InferenceEngineProfileInfo::EXECUTED;
+    return {{name, info}};
+}
+}  // namespace
+
+class PartialBatchTest : public ::testing::Test {
+public:
+    const int batch_size = 4;
+    const int partial_batch_size = 2;
+
+    std::shared_ptr<NiceMock<MockIExecutableNetworkInternal>> mockIExecNetWithBatch;
+    std::shared_ptr<NiceMock<MockIExecutableNetworkInternal>> mockIExecNetWithoutBatch;
+    std::shared_ptr<NiceMock<MockIExecutableNetworkInternal>> mockIExecNetPartialBatch;
+    std::shared_ptr<NiceMock<MockIInferRequestInternal>> partialBatchRequest;
+    std::function<void(std::exception_ptr)> partialBatchCallback;
+    std::atomic<int> partialBatchStarts{0};
+
+    std::shared_ptr<CompiledModel> actualExecNet;
+
+    void SetUp() override {
+        mockIExecNetWithBatch = std::make_shared<NiceMock<MockIExecutableNetworkInternal>>();
+        mockIExecNetWithoutBatch = std::make_shared<NiceMock<MockIExecutableNetworkInternal>>();
+        mockIExecNetPartialBatch = std::make_shared<NiceMock<MockIExecutableNetworkInternal>>();
+        partialBatchRequest = std::make_shared<NiceMock<MockIInferRequestInternal>>();
+
+        ON_CALL(*mockIExecNetWithBatch, CreateInferRequest()).WillByDefault([]() {
+            return std::make_shared<NiceMock<MockIInferRequestInternal>>();
+        });
+        ON_CALL(*mockIExecNetWithoutBatch, CreateInferRequest()).WillByDefault([]() {
+            auto request = std::make_shared<NiceMock<MockIInferRequestInternal>>();
+            ON_CALL(*request, GetPerformanceCounts()).WillByDefault(Return(make_perf_counts("batch1")));
+            return request;
+        });
+        ON_CALL(*mockIExecNetPartialBatch, CreateInferRequest()).WillByDefault(Return(partialBatchRequest));
+
+        ON_CALL(*partialBatchRequest, SetCallback(_))
+            .WillByDefault([this](std::function<void(std::exception_ptr)> callback) {
+                partialBatchCallback = std::move(callback);
+            });
+        ON_CALL(*partialBatchRequest, StartAsync()).WillByDefault([this]() {
+            partialBatchStarts++;
+            partialBatchCallback(nullptr);
+        });
+        ON_CALL(*partialBatchRequest, GetPerformanceCounts()).WillByDefault(Return(make_perf_counts("partial")));
+
+        DeviceInformation metaDevice = {"CPU", {}, batch_size};
+        std::unordered_map<std::string, InferenceEngine::Parameter> config = {{CONFIG_KEY(AUTO_BATCH_TIMEOUT), "10"}};
+        std::map<int, SoExecutableNetworkInternal> partialBatchNetworks = {
+            {partial_batch_size, {mockIExecNetPartialBatch, {}}}};
+        actualExecNet = std::make_shared<CompiledModel>(SoExecutableNetworkInternal{mockIExecNetWithBatch, {}},
+                                                        SoExecutableNetworkInternal{mockIExecNetWithoutBatch, {}},
+                                                        metaDevice,
+                                                        config,
+                                                        std::set<std::string>{},
+                                                        std::set<std::string>{},
+                                                        partialBatchNetworks);
+    }
+
+    void TearDown() override {
+        actualExecNet.reset();
+        partialBatchCallback = {};
+        partialBatchRequest.reset();
+        mockIExecNetWithBatch.reset();
+        mockIExecNetWithoutBatch.reset();
+        mockIExecNetPartialBatch.reset();
+    }
+};
+
+TEST_F(PartialBatchTest, TimedOutRequestsAreExecutedAsPartialBatch) {
+    std::vector<IInferRequestInternal::Ptr> requests;
+    for (int i = 0; i < batch_size; i++)
+        requests.push_back(actualExecNet->CreateInferRequest());
+
+    // only the part of the batch is submitted, so the collection times out
+    for (int i = 0; i < partial_batch_size; i++)
+        ASSERT_NO_THROW(requests[i]->StartAsync());
+    for (int i = 0; i < partial_batch_size; i++)
+        ASSERT_EQ(StatusCode::OK, requests[i]->Wait(InferRequest::WaitMode::RESULT_READY));
+
+    // usually one partial batch, but the timeout may expire between the submissions
+    EXPECT_GE(partialBatchStarts.load(), 1);
+    for (int i = 0; i < partial_batch_size; i++) {
+        const auto perfCounts = requests[i]->GetPerformanceCounts();
+        EXPECT_EQ(1, perfCounts.count("partial"));
+        EXPECT_EQ(0, perfCounts.count("batch1"));
+    }
+
+    const auto statistics =
+        actualExecNet->GetMetric(auto_batch_statistics.name()).as<std::map<std::string, uint64_t>>();
+    EXPECT_EQ(static_cast<uint64_t>(partialBatchStarts.load()), statistics.at("partial_batches"));
+    EXPECT_EQ(static_cast<uint64_t>(partial_batch_size), statistics.at("timed_out_requests"));
+    requests.clear();
+}
@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <functional>
 #include "lru_cache.h"
+#include "sharded_lru_cache.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -17,8 +19,15 @@ public:
         Hit,
         Miss
     };
+
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+    };
 public:
     virtual ~CacheEntryBase() = default;
+    virtual Statistics getStatistics() const = 0;
 };
 
 /**
@@ -62,12 +71,78 @@ public:
             retVal = builder(key);
             if (retVal != retEmpty)
                 _impl.put(key, retVal);
+            ++_misses;
+        } else {
+            ++_hits;
         }
         return {retVal, retStatus};
     }
 
+    Statistics getStatistics() const override {
+        Statistics stats;
+        stats.hits = _hits;
+        stats.misses = _misses;
+        stats.evictions = _impl.getEvictionsCount();
+        return stats;
+    }
+
 public:
     ImplType _impl;
+
+private:
+    size_t _hits = 0;
+    size_t _misses = 0;
+};
+
+/**
+ * @brief Thread safe counterpart of the CacheEntry which may be shared between several streams
+ * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * @note The builder is called outside of the cache locks, so the same value may be built concurrently by several threads.
+ *       Only the first stored value is kept and returned to all the callers.
+ */
+
+template<typename KeyType,
+         typename ValType>
+class SharedCacheEntry : public CacheEntryBase {
+public:
+    using ResultType = std::pair<ValType, LookUpStatus>;
+
+public:
+    explicit SharedCacheEntry(size_t capacity) : _impl(capacity) {}
+
+    ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
+        if (0 == _impl.getCapacity()) {
+            // fast track
+            _misses.fetch_add(1, std::memory_order_relaxed);
+            return {builder(key), CacheEntryBase::LookUpStatus::Miss};
+        }
+        ValType retVal = _impl.get(key);
+        auto retEmpty = ValType();
+        if (retVal != retEmpty) {
+            _hits.fetch_add(1, std::memory_order_relaxed);
+            return {retVal, LookUpStatus::Hit};
+        }
+        _misses.fetch_add(1, std::memory_order_relaxed);
+        retVal = builder(key);
+        if (retVal != retEmpty)
+            retVal = _impl.putIfAbsent(key, retVal);
+        return {retVal, LookUpStatus::Miss};
+    }
+
+    Statistics getStatistics() const override {
+        Statistics stats;
+        stats.hits = _hits.load(std::memory_order_relaxed);
+        stats.misses = _misses.load(std::memory_order_relaxed);
+        stats.evictions = _impl.getEvictionsCount();
+        return stats;
+    }
+
+private:
+    ShardedLruCache<KeyType, ValType> _impl;
+    std::atomic_size_t _hits{0};
+    std::atomic_size_t _misses{0};
 };
 
 }   // namespace intel_cpu
@@ -9,5 +9,19 @@ namespace intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+CacheEntryBase::Statistics MultiCache::getStatistics() const {
+    std::unique_lock<std::mutex> lock(_storageMutex, std::defer_lock);
+    if (_shared)
+        lock.lock();
+    CacheEntryBase::Statistics result;
+    for (const auto& item : _storage) {
+        const auto stats = item.second->getStatistics();
+        result.hits += stats.hits;
+        result.misses += stats.misses;
+        result.evictions += stats.evictions;
+    }
+    return result;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
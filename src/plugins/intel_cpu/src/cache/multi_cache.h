@@ -7,15 +7,32 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
+#include <type_traits>
 #include "cache_entry.h"
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief Tells whether the values built for the KeyType may be kept in the shared cache, i.e. executed by several streams
+ *        at once. A key type opts out by declaring the static constexpr bool sharedCacheAllowed = false member,
+ *        it has to be done for the values keeping a mutable state of the execution (e.g. scratch buffers).
+ */
+template<typename KeyType, typename = void>
+struct IsShareableCacheKey : std::true_type {};
+
+template<typename KeyType>
+struct IsShareableCacheKey<KeyType, decltype(void(KeyType::sharedCacheAllowed))>
+    : std::integral_constant<bool, KeyType::sharedCacheAllowed> {};
+
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention This implementation IS NOT THREAD SAFE unless it is created as a shared cache!
+ *            The shared cache keeps records in the sharded thread safe entries and may be used by several streams at once.
+ *            The private cache of a stream may forward the lookups to a shared cache, the values of the keys which aren't
+ *            shareable (see IsShareableCacheKey) are kept in the private cache then.
  */
 
 class MultiCache {
@@ -29,9 +46,21 @@ public:
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @param shared defines whether the cache may be accessed concurrently from different threads
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool shared = false) : _capacity(capacity), _shared(shared) {}
+
+    /**
+    * @brief Creates the private cache forwarding the lookups of the shareable keys to the shared cache
+    * @param capacity is the records limit of the private entries
+    * @param sharedCache is the cache shared with the other streams, the private cache is standalone if it is null
+    */
+    MultiCache(size_t capacity, std::shared_ptr<MultiCache> sharedCache)
+        : _capacity(capacity), _shared(false), _sharedCache(std::move(sharedCache)) {}
+
+    MultiCache(const MultiCache& other)
+        : _capacity(other._capacity), _shared(other._shared), _sharedCache(other._sharedCache), _storage(other._storage) {}
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -45,20 +74,41 @@ public:
     template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
     typename CacheEntry<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
-        auto entry = getEntry<KeyType, ValueType>();
+        if (_shared) {
+            auto entry = getEntry<SharedCacheEntry<KeyType, ValueType>>();
+            return entry->getOrCreate(key, std::move(builder));
+        }
+        if (_sharedCache && IsShareableCacheKey<KeyType>::value) {
+            return _sharedCache->getOrCreate<KeyType, BuilderType, ValueType>(key, std::move(builder));
+        }
+        auto entry = getEntry<EntryTypeT<KeyType, ValueType>>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+    * @brief Collects the lookup statistics over all the entries of the cache
+    * @return accumulated number of cache hits, misses and evicted records, the lookups forwarded to the shared cache
+    *         are not included
+    */
+    CacheEntryBase::Statistics getStatistics() const;
+
+    bool isShared() const noexcept {
+        return _shared;
+    }
+
 private:
     template<typename T>
     size_t getTypeId();
-    template<typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template<typename EntryType>
+    std::shared_ptr<EntryType> getEntry();
 
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    bool _shared;
+    std::shared_ptr<MultiCache> _sharedCache;
     std::unordered_map<size_t, EntryBasePtr> _storage;
+    mutable std::mutex _storageMutex;  // used only by the shared cache
 };
 
 template<typename T>
@@ -67,10 +117,12 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template<typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template<typename EntryType>
+std::shared_ptr<EntryType> MultiCache::getEntry() {
     size_t id = getTypeId<EntryType>();
+    std::unique_lock<std::mutex> lock(_storageMutex, std::defer_lock);
+    if (_shared)
+        lock.lock();
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
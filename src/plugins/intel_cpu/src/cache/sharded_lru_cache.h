@@ -0,0 +1,119 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "lru_cache.h"
+
+/**
+ * @brief Thread safe preemptive cache which splits the records between independent shards by the key hash.
+ * Each shard is an LRU cache guarded by its own lock, so the concurrent lookups of different keys rarely contend.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * @note The LRU eviction policy is applied per shard, so the total capacity is split evenly between the shards.
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+template<typename Key, typename Value>
+class ShardedLruCache {
+public:
+    static constexpr size_t defaultShardsNumber = 16;
+
+public:
+    explicit ShardedLruCache(size_t capacity, size_t shardsNumber = defaultShardsNumber) : _capacity(capacity) {
+        if (0 == _capacity) {
+            return;
+        }
+        shardsNumber = std::max<size_t>(1, std::min(shardsNumber, _capacity));
+        const size_t shardCapacity = (_capacity + shardsNumber - 1) / shardsNumber;
+        _shards.reserve(shardsNumber);
+        for (size_t i = 0; i < shardsNumber; ++i) {
+            _shards.emplace_back(new Shard(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache if the key is not there yet.
+     * @param key
+     * @param value
+     * @return The value associated with the key after the operation, so concurrent callers get the same object
+     */
+
+    Value putIfAbsent(const Key &key, const Value &val) {
+        if (0 == _capacity) {
+            return val;
+        }
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard._mutex);
+        auto stored = shard._cache.get(key);
+        if (stored != Value()) {
+            return stored;
+        }
+        const auto evictions = shard._cache.getEvictionsCount();
+        shard._cache.put(key, val);
+        _evictions.fetch_add(shard._cache.getEvictionsCount() - evictions, std::memory_order_relaxed);
+        return val;
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key &key) {
+        if (0 == _capacity) {
+            return Value();
+        }
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard._mutex);
+        return shard._cache.get(key);
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the number of records evicted from all the shards so far
+     * @return the number of evicted records
+     */
+    size_t getEvictionsCount() const noexcept {
+        return _evictions.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Shard {
+        explicit Shard(size_t capacity) : _cache(capacity) {}
+        std::mutex _mutex;
+        LruCache<Key, Value> _cache;
+    };
+
+    Shard& getShard(const Key &key) {
+        // the hash is mixed to keep the shard choice independent of the bucket choice inside the shard
+        const uint64_t hash = static_cast<uint64_t>(key.hash()) * 0x9E3779B97F4A7C15ull;
+        return *_shards[(hash >> 32) % _shards.size()];
+    }
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _capacity;
+    std::atomic_size_t _evictions{0};
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
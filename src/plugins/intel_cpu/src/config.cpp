@@ -18,6 +18,7 @@
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "utils/debug_capabilities.h"
+#include "internal_properties.hpp"
 #include "cpu/x64/cpu_isa_traits.hpp"
 
 namespace ov {
@@ -141,6 +142,12 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS
                                    << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::parallel_nodes_execution.name()) {
+            if (val == PluginConfigParams::YES) parallelNodesExecution = true;
+            else if (val == PluginConfigParams::NO) parallelNodesExecution = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::parallel_nodes_execution.name()
+                                   << ". Expected only YES/NO";
             IE_SUPPRESS_DEPRECATED_START
         } else if (key.compare(PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT) == 0) {
             IE_SUPPRESS_DEPRECATED_END
@@ -201,6 +208,27 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (key == ov::intel_cpu::shared_runtime_cache.name()) {
+            if (val == PluginConfigParams::YES) sharedRtCache = true;
+            else if (val == PluginConfigParams::NO) sharedRtCache = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::shared_runtime_cache.name()
+                                   << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::shared_workspace.name()) {
+            if (val == PluginConfigParams::YES) sharedWorkspace = true;
+            else if (val == PluginConfigParams::NO) sharedWorkspace = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::shared_workspace.name()
+                                   << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::numa_weights_binding.name()) {
+            if (val == PluginConfigParams::YES) numaWeightsBinding = true;
+            else if (val == PluginConfigParams::NO) numaWeightsBinding = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::numa_weights_binding.name()
+                                   << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::weights_cache_dir.name()) {
+            // empty string means that the repacked weights are not persisted
+            weightsCacheDir = val;
         } else if (CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION == key) {
             if (val == PluginConfigParams::YES) {
                 denormalsOptMode = DenormalsOptMode::DO_On;
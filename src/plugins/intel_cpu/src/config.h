@@ -47,9 +47,14 @@ struct Config {
 
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
+    bool parallelNodesExecution = false;
+    bool sharedRtCache = false;
+    bool sharedWorkspace = false;
+    bool numaWeightsBinding = false;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
     std::string dumpToDot = {};
     std::string device_id = {};
+    std::string weightsCacheDir = {};
     float fcSparseWeiDecompressionRate = 1.0f;
 #if defined(OPENVINO_ARCH_X86_64)
     size_t rtCacheCapacity = 5000ul;
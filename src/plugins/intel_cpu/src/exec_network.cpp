@@ -12,6 +12,7 @@
 #include "memory_state.h"
 #include "itt.h"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "internal_properties.hpp"
 #include "serialize.h"
 #include "ngraph/type/element_type.hpp"
 #include "nodes/memory.hpp"
@@ -71,7 +72,8 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     extensionManager(extMgr),
     _network(network),
     _cfg{cfg},
-    _name{network.getName()} {
+    _name{network.getName()},
+    _numaNodesWeights{cfg.numaWeightsBinding} {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -114,6 +116,13 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         _callbackExecutor = _taskExecutor;
     }
+    if (_cfg.sharedRtCache) {
+        _sharedRtCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity, true);
+    }
+    _snippetsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity, true);
+    if (_cfg.sharedWorkspace) {
+        _workspacePool = std::make_shared<WorkspacePool>();
+    }
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
@@ -153,7 +162,7 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (suffix_idx != std::string::npos)
                     state_name = state_name.substr(0, suffix_idx);
 
-                memoryStates.emplace_back(new VariableState(state_name, state_store));
+                memoryStates.emplace_back(new VariableState(state_name, state_store, memoryNode->isDynamicNode()));
             }
         }
     }
@@ -183,8 +192,14 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                         (_cfg.lpTransformsMode == Config::On) &&
                         ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
 
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, isQuantizedFlag);
+                    ctx = std::make_shared<GraphContext>(_cfg,
+                                                         extensionManager,
+                                                         weightsCache,
+                                                         isQuantizedFlag,
+                                                         _sharedRtCache,
+                                                         _snippetsCache);
                 }
+                graphLock._graph.setWorkspacePool(_workspacePool);
                 graphLock._graph.CreateGraph(_network, ctx);
             } catch (...) {
                 exception = std::current_exception();
@@ -270,6 +285,21 @@ InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name,
 InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const {
     if (_graphs.empty())
         IE_THROW() << "No graph was found";
+    if (!_cfg.isLegacyApi && name == ov::intel_cpu::runtime_cache_statistics) {
+        // must be handled before the current stream graph is locked, since all the graphs are visited
+        return decltype(ov::intel_cpu::runtime_cache_statistics)::value_type(GetRtCacheStatistics());
+    }
+    if (!_cfg.isLegacyApi && name == ov::intel_cpu::snippets_cache_statistics) {
+        const auto stats = _snippetsCache->getStatistics();
+        return decltype(ov::intel_cpu::snippets_cache_statistics)::value_type(
+            {{"hits", stats.hits}, {"misses", stats.misses}, {"evictions", stats.evictions}});
+    }
+    if (!_cfg.isLegacyApi && name == ov::intel_cpu::weights_memory_statistics) {
+        std::map<std::string, uint64_t> statistics;
+        for (const auto& size : _numaNodesWeights.getTotalSizes())
+            statistics[std::to_string(size.first)] = size.second;
+        return decltype(ov::intel_cpu::weights_memory_statistics)::value_type(statistics);
+    }
     // @todo Can't we just use local copy (_cfg) instead?
     auto graphLock = GetGraph();
     const auto& graph = graphLock._graph;
@@ -302,6 +332,9 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::execution_devices.name()),
             RO_property(ov::intel_cpu::denormals_optimization.name()),
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+            RO_property(ov::intel_cpu::runtime_cache_statistics.name()),
+            RO_property(ov::intel_cpu::weights_memory_statistics.name()),
+            RO_property(ov::intel_cpu::snippets_cache_statistics.name()),
         };
     }
 
@@ -365,6 +398,24 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
     return GetMetricLegacy(name, graph);
 }
 
+std::map<std::string, uint64_t> ExecNetwork::GetRtCacheStatistics() const {
+    CacheEntryBase::Statistics stats;
+    if (_sharedRtCache)
+        stats = _sharedRtCache->getStatistics();
+    // the per stream caches are not thread safe, so each graph is locked while its cache is being read;
+    // with the shared cache they keep the primitives which can't be shared
+    for (auto& graph : _graphs) {
+        GraphGuard::Lock graphLock(graph);
+        if (!graphLock._graph.IsReady())
+            continue;
+        const auto graphStats = graphLock._graph.getGraphContext()->getParamsCache()->getStatistics();
+        stats.hits += graphStats.hits;
+        stats.misses += graphStats.misses;
+        stats.evictions += graphStats.evictions;
+    }
+    return {{"hits", stats.hits}, {"misses", stats.misses}, {"evictions", stats.evictions}};
+}
+
 void ExecNetwork::Export(std::ostream& modelStream) {
     CNNNetworkSerializer serializer(modelStream, extensionManager);
     serializer <<_network;
@@ -69,6 +69,12 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable NumaNodesWeights                    _numaNodesWeights;
+    // runtime cache shared between all the streams, used only when Config::sharedRtCache is set
+    MultiCachePtr                               _sharedRtCache;
+    // generated snippets kernels shared between all the streams
+    MultiCachePtr                               _snippetsCache;
+    // pool of the intermediate tensors memory, used only when Config::sharedWorkspace is set
+    WorkspacePool::Ptr                          _workspacePool;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -79,6 +85,8 @@ protected:
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
 
     InferenceEngine::Parameter GetMetricLegacy(const std::string &name, const GraphGuard& graph) const;
+
+    std::map<std::string, uint64_t> GetRtCacheStatistics() const;
 };
 
 }   // namespace intel_cpu
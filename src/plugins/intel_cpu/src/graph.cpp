@@ -12,6 +12,7 @@
 #include <fstream>
 #include <unordered_map>
 #include <memory>
+#include <functional>
 #include <utility>
 
 #include "graph.h"
@@ -44,6 +45,7 @@
 #include "utils/verbose.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
+#include <openvino/core/compile_profiler.hpp>
 #include <ngraph/node.hpp>
 #include <ngraph/function.hpp>
 #include <ngraph/ops.hpp>
@@ -346,20 +348,35 @@ void Graph::Replicate(const CNNNetwork &network) {
 void Graph::InitGraph() {
     GraphOptimizer optimizer;
 
-    SortTopologically();
-    InitNodes();
+    // the compile statistics of every stage are recorded if the compile profiler is enabled
+    auto runStage = [this](const char* stageName, const std::function<void()>& stage) {
+        ov::CompileProfiler::Scope profileScope;
+        if (ov::CompileProfiler::get().is_enabled()) {
+            profileScope.start("cpu_graph", GetName() + "::" + stageName, [this]() {
+                return graphNodes.size();
+            });
+        }
+        stage();
+    };
+
+    runStage("SortTopologically", [&]() { SortTopologically(); });
+    runStage("InitNodes", [&]() { InitNodes(); });
 
-    optimizer.ApplyCommonGraphOptimizations(*this);
-    SortTopologically();
+    runStage("ApplyCommonGraphOptimizations", [&]() {
+        optimizer.ApplyCommonGraphOptimizations(*this);
+        SortTopologically();
+    });
 
-    InitDescriptors();
+    runStage("InitDescriptors", [&]() { InitDescriptors(); });
 
-    InitOptimalPrimitiveDescriptors();
+    runStage("InitOptimalPrimitiveDescriptors", [&]() { InitOptimalPrimitiveDescriptors(); });
 
-    InitEdges();
+    runStage("InitEdges", [&]() { InitEdges(); });
 
-    optimizer.ApplyImplSpecificGraphOptimizations(*this);
-    SortTopologically();
+    runStage("ApplyImplSpecificGraphOptimizations", [&]() {
+        optimizer.ApplyImplSpecificGraphOptimizations(*this);
+        SortTopologically();
+    });
 
     bool haveDynNodes = false;
     for (size_t i = 0; i < graphNodes.size(); ++i) {
@@ -386,9 +403,16 @@ void Graph::InitGraph() {
         this->reuse_io_tensors = false;
     }
 
-    Allocate();
+    // the independent nodes are executed concurrently only for static graphs, since the dynamic ones rely on
+    // the sequential shape inference and memory resizing
+    parallelExecution = !haveDynNodes && getConfig().parallelNodesExecution;
+    for (auto &graphNode : graphNodes) {
+        graphNode->setConcurrentExecution(parallelExecution);
+    }
 
-    CreatePrimitivesAndExecConstants();
+    runStage("Allocate", [&]() { Allocate(); });
+
+    runStage("CreatePrimitivesAndExecConstants", [&]() { CreatePrimitivesAndExecConstants(); });
 
 #ifndef CPU_DEBUG_CAPS
     for (auto &graphNode : graphNodes) {
@@ -396,11 +420,35 @@ void Graph::InitGraph() {
     }
 #endif
 
-    ExtractExecutableNodes();
+    runStage("ExtractExecutableNodes", [&]() { ExtractExecutableNodes(); });
+
+    // the pooled tensors point to the released memory until the first execution binds an arena
+    initWorkspace = nullptr;
 
     status = haveDynNodes ? Status::ReadyDynamic : Status::ReadyStatic;
 }
 
+void Graph::acquireWorkspace() {
+    if (pooledMemory.empty() || pooledWorkspace)
+        return;
+
+    pooledWorkspace = workspacePool->acquire(pooledWorkspaceSize, getEngine());
+    // the tensors are rebound only if the graph got another arena than the one it used last time
+    if (pooledWorkspace->GetData() == pooledWorkspaceBase)
+        return;
+    pooledWorkspaceBase = pooledWorkspace->GetData();
+    for (auto& memory : pooledMemory)
+        memory.mngr->setExtBuff(static_cast<int8_t*>(pooledWorkspaceBase) + memory.offset, memory.size);
+}
+
+void Graph::releaseWorkspace() {
+    if (!pooledWorkspace)
+        return;
+
+    workspacePool->release(std::move(pooledWorkspace));
+    pooledWorkspace = nullptr;
+}
+
 void Graph::InitNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::InitNodes");
     for (auto &node : graphNodes) {
@@ -481,6 +529,16 @@ void Graph::ExtractExecutableNodes() {
             executableGraphNodes.emplace_back(graphNode);
         }
     }
+
+    if (!execLevels.empty()) {
+        std::map<int, std::vector<NodePtr>> levels;
+        for (const auto& node : executableGraphNodes) {
+            levels[execLevels[node->getExecIndex()]].push_back(node);
+        }
+        for (auto& level : levels) {
+            executableGraphLevels.emplace_back(std::move(level.second));
+        }
+    }
 }
 
 void Graph::CreatePrimitivesAndExecConstants() const {
@@ -676,9 +734,87 @@ static edge_clusters_t findEdgeClusters(const std::vector<EdgePtr> & graphEdges)
     return edge_clusters;
 }
 
+/**
+ * Splits the graph nodes into levels of the dependency DAG: each node is placed to the level next to the latest level
+ * of its predecessors. Besides the data edges, the nodes accessing the same edge cluster memory are ordered, so a node
+ * which writes the memory (producer, in-place consumer) never runs concurrently with the previous readers and writers of
+ * the cluster. The stateful nodes and the nodes with inner graphs keep their original relative order as well.
+ * @return levels indexed by the node exec index
+ */
+static std::vector<int> calculateExecutionLevels(const std::vector<NodePtr>& graphNodes, const edge_clusters_t& edgeClusters) {
+    std::vector<std::vector<int>> predecessors(graphNodes.size());
+
+    for (const auto& node : graphNodes) {
+        for (const auto& parentEdge : node->getParentEdges()) {
+            auto edge = parentEdge.lock();
+            if (edge)
+                predecessors[node->getExecIndex()].push_back(edge->getParent()->getExecIndex());
+        }
+    }
+
+    for (const auto& cluster : edgeClusters) {
+        // exec index -> whether the node writes to the cluster memory
+        std::map<int, bool> accesses;
+        for (const auto& edge : cluster) {
+            accesses[edge->getParent()->getExecIndex()] = true;
+            accesses.emplace(edge->getChild()->getExecIndex(), false);
+        }
+
+        int lastWriter = -1;
+        std::vector<int> readers;
+        for (const auto& access : accesses) {
+            auto& nodePredecessors = predecessors[access.first];
+            if (lastWriter != -1)
+                nodePredecessors.push_back(lastWriter);
+            if (access.second) {
+                nodePredecessors.insert(nodePredecessors.end(), readers.begin(), readers.end());
+                readers.clear();
+                lastWriter = access.first;
+            } else {
+                readers.push_back(access.first);
+            }
+        }
+    }
+
+    int lastStatefulNode = -1;
+    int lastSubGraphNode = -1;
+    for (const auto& node : graphNodes) {
+        if (one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput)) {
+            if (lastStatefulNode != -1)
+                predecessors[node->getExecIndex()].push_back(lastStatefulNode);
+            lastStatefulNode = node->getExecIndex();
+        }
+        // the inner graphs executed sequentially use the scratchpad shared across the context, so they never overlap
+        if (one_of(node->getType(), Type::If, Type::TensorIterator)) {
+            if (lastSubGraphNode != -1)
+                predecessors[node->getExecIndex()].push_back(lastSubGraphNode);
+            lastSubGraphNode = node->getExecIndex();
+        }
+    }
+
+    std::vector<int> levels(graphNodes.size(), 0);
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        for (auto predecessor : predecessors[i]) {
+            if (predecessor < static_cast<int>(i))
+                levels[i] = std::max(levels[i], levels[predecessor] + 1);
+        }
+    }
+
+    return levels;
+}
+
 void Graph::AllocateWithReuse() {
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
 
+    // In the parallel execution mode the nodes of one level may run concurrently, so the lifetime of the tensors is
+    // measured in levels instead of exec indices to prevent memory reuse between the concurrent nodes.
+    if (parallelExecution) {
+        execLevels = calculateExecutionLevels(graphNodes, edge_clusters);
+    }
+    auto timestamp = [this](const NodePtr& node) {
+        return execLevels.empty() ? node->execIndex : execLevels[node->execIndex];
+    };
+
     size_t edge_clusters_count = edge_clusters.size();
 
     for (size_t i = 0; i < edge_clusters_count;) {
@@ -710,13 +846,14 @@ void Graph::AllocateWithReuse() {
     const int64_t alignment = 32;  // 32 bytes
 
     std::vector<MemorySolver::Box> definedBoxes;
+    std::vector<MemorySolver::Box> pooledBoxes;
     std::vector<MemorySolver::Box> undefinedBoxes;
     for (size_t i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box box = {std::numeric_limits<int>::max(), 0, 0, static_cast<int64_t>(i)};
         int64_t boxSize = 0;
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = timestamp(edge->getParent());
+            int e_finish = timestamp(edge->getChild());
 
             if (boxSize != -1 && edge->getDesc().isDefined()) {
                 int64_t e_size = edge->getDesc().getCurrentMemSize();  // size in bytes (from the beginning of data to the last element)
@@ -751,7 +888,12 @@ void Graph::AllocateWithReuse() {
 
         if (boxSize != -1) {
             box.size = div_up(boxSize, alignment);
-            definedBoxes.push_back(box);
+            // the constant data are computed once on load, so only the other tensors may live in the pooled arenas
+            if (workspacePool && !isConst) {
+                pooledBoxes.push_back(box);
+            } else {
+                definedBoxes.push_back(box);
+            }
         } else {
             box.size = boxSize;
             undefinedBoxes.push_back(box);
@@ -767,27 +909,51 @@ void Graph::AllocateWithReuse() {
     if (edge_clusters.empty())
         return;
 
-    auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
-
-    for (auto& box : definedBoxes) {
-        int count = 0;
-        for (auto& edge : edge_clusters[box.id]) {
-            if (edge->getStatus() == Edge::Status::NeedAllocation) {
-                int64_t offset = staticMemSolver.getOffset(box.id);
-                // !! Fallback to individual memory allocation !!
-                // if you like to check infer without reuse just call this function without arguments.
-                edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
-
-                // TODO: WA for some test (like strided_slice_test) which use tensors with
-                //       shapes {0}. And it is implisitly converted into {1} tensor.
-                //       Zeroing of input data allow pass tests.
-                if (edge->getParent()->type == Type::Input && edge->hasDefinedMaxSize())
-                    edge->getMemoryPtr()->FillZero();
+    auto allocateBoxes = [&](const std::vector<MemorySolver::Box>& boxes,
+                             const MemorySolver& memSolver,
+                             int8_t* workspace_ptr,
+                             bool pooled) {
+        for (auto& box : boxes) {
+            int count = 0;
+            for (auto& edge : edge_clusters[box.id]) {
+                if (edge->getStatus() == Edge::Status::NeedAllocation) {
+                    int64_t offset = memSolver.getOffset(box.id);
+                    // !! Fallback to individual memory allocation !!
+                    // if you like to check infer without reuse just call this function without arguments.
+                    edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
+
+                    // TODO: WA for some test (like strided_slice_test) which use tensors with
+                    //       shapes {0}. And it is implisitly converted into {1} tensor.
+                    //       Zeroing of input data allow pass tests.
+                    if (edge->getParent()->type == Type::Input && edge->hasDefinedMaxSize())
+                        edge->getMemoryPtr()->FillZero();
+
+                    if (pooled) {
+                        const auto& memory = edge->getMemoryPtr();
+                        pooledMemory.push_back({memory->getDnnlMemoryMngr(),
+                                                static_cast<size_t>(offset * alignment),
+                                                memory->GetSize()});
+                    }
 
-                count++;
+                    count++;
+                }
             }
+            IE_ASSERT(count == 1);
         }
-        IE_ASSERT(count == 1);
+    };
+
+    allocateBoxes(definedBoxes, staticMemSolver, static_cast<int8_t*>(memWorkspace->GetData()), false);
+
+    if (!pooledBoxes.empty()) {
+        MemorySolver pooledMemSolver(pooledBoxes);
+        pooledWorkspaceSize = static_cast<size_t>(pooledMemSolver.solve()) * alignment;
+        // the nodes may access the memory while creating the primitives, so a private arena is used until the end of
+        // the graph initialization. The graphs are initialized concurrently, and the pool would keep an arena per graph
+        // otherwise.
+        initWorkspace = std::make_shared<Memory>(getEngine());
+        initWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8,
+                                                    Shape(InferenceEngine::SizeVector{pooledWorkspaceSize})));
+        allocateBoxes(pooledBoxes, pooledMemSolver, static_cast<int8_t*>(initWorkspace->GetData()), true);
     }
 
     if (!undefinedBoxes.empty()) {
@@ -1001,6 +1167,32 @@ void Graph::InferStatic(InferRequestBase* request) {
     }
 }
 
+void Graph::InferStaticParallel(InferRequestBase* request) {
+    dnnl::stream stream(getEngine());
+
+    for (const auto& level : executableGraphLevels) {
+        if (request)
+            request->ThrowIfCanceled();
+
+        if (level.size() == 1) {
+            const auto& node = level.front();
+            VERBOSE(node, getConfig().debugCaps.verbose);
+            PERF(node, getConfig().collectPerfCounters);
+            ExecuteNode(node, stream);
+            continue;
+        }
+
+        // the nodes of one level are independent, each of them may still use nested parallelism inside
+        parallel_for(level.size(), [&](size_t i) {
+            const auto& node = level[i];
+            VERBOSE(node, getConfig().debugCaps.verbose);
+            PERF(node, getConfig().collectPerfCounters);
+            dnnl::stream localStream(getEngine());
+            ExecuteNode(node, localStream);
+        });
+    }
+}
+
 namespace {
 
 class IUpdateNodes {
@@ -1252,7 +1444,10 @@ void Graph::Infer(InferRequestBase* request) {
     if (Status::ReadyDynamic == status) {
         InferDynamic(request);
     } else if (Status::ReadyStatic == status) {
-        InferStatic(request);
+        if (executableGraphLevels.empty())
+            InferStatic(request);
+        else
+            InferStaticParallel(request);
     } else {
         IE_THROW() << "Unknown ov::intel_cpu::Graph state: " << static_cast<size_t>(status);
     }
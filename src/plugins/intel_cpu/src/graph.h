@@ -13,6 +13,7 @@
 #include "cache/multi_cache.h"
 #include "dnnl_scratch_pad.h"
 #include "graph_context.h"
+#include "workspace_pool.h"
 #include <map>
 #include <string>
 #include <vector>
@@ -49,6 +50,32 @@ public:
     template<typename NET>
     void CreateGraph(NET &network, const GraphContext::CPtr ctx);
 
+    /**
+     * Makes the graph take the memory for the intermediate tensors from the pool only while it is used, instead of
+     * holding a private workspace. The constant tensors keep the private memory. Must be set before the graph creation.
+     * The nodes are expected to take the memory pointers on the execution, as it is done for the dynamic shapes.
+     */
+    void setWorkspacePool(WorkspacePool::Ptr pool) {
+        workspacePool = std::move(pool);
+    }
+
+    /**
+     * Binds an arena of the workspace pool to the graph tensors for the guard lifetime, does nothing if the pool isn't
+     * used
+     */
+    class WorkspaceGuard {
+    public:
+        explicit WorkspaceGuard(Graph& graph) : graph(graph) {
+            graph.acquireWorkspace();
+        }
+        ~WorkspaceGuard() {
+            graph.releaseWorkspace();
+        }
+
+    private:
+        Graph& graph;
+    };
+
     void CreateGraph(const std::vector<NodePtr> &graphNodes,
                      const std::vector<EdgePtr> &graphEdges,
                      const GraphContext::CPtr ctx,
@@ -202,6 +229,12 @@ protected:
         graphEdges.clear();
         _normalizePreprocMap.clear();
         syncNodesInds.clear();
+        execLevels.clear();
+        executableGraphLevels.clear();
+        releaseWorkspace();
+        initWorkspace = nullptr;
+        pooledMemory.clear();
+        pooledWorkspaceBase = nullptr;
     }
     Status status { Status::NotReady };
 
@@ -213,6 +246,18 @@ protected:
 
     MemoryPtr memWorkspace;
 
+    struct PooledMemory {
+        DnnlMemoryMngrPtr mngr;
+        size_t offset;
+        size_t size;
+    };
+    WorkspacePool::Ptr workspacePool;
+    std::vector<PooledMemory> pooledMemory;  // the tensors placed to the pooled arenas
+    size_t pooledWorkspaceSize = 0;
+    MemoryPtr initWorkspace;                 // the private arena used during the graph initialization
+    MemoryPtr pooledWorkspace;               // the arena held while the graph is executed
+    void* pooledWorkspaceBase = nullptr;     // the pooled arena the tensors point to
+
     std::vector<NodePtr> graphNodes;
     std::vector<EdgePtr> graphEdges;
 
@@ -230,10 +275,13 @@ protected:
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    void acquireWorkspace();
+    void releaseWorkspace();
     void ExtractExecutableNodes();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void CreatePrimitivesAndExecConstants() const;
     void InferStatic(InferRequestBase* request);
+    void InferStaticParallel(InferRequestBase* request);
     void InferDynamic(InferRequestBase* request);
 
     friend class LegacyInferRequest;
@@ -253,6 +301,12 @@ private:
 
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // parallel nodes execution mode: the DAG level of each node (indexed by exec index) and the executable nodes
+    // grouped by levels, the nodes of the same level don't depend on each other and may run concurrently
+    bool parallelExecution = false;
+    std::vector<int> execLevels;
+    std::vector<std::vector<NodePtr>> executableGraphLevels;
+
     GraphContext::CPtr context;
 
     void EnforceInferencePrecision();
@@ -9,6 +9,7 @@
 #include "dnnl_scratch_pad.h"
 #include "extension_mngr.h"
 #include "weights_cache.hpp"
+#include "weights_disk_cache.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -18,15 +19,28 @@ public:
     typedef std::shared_ptr<GraphContext> Ptr;
     typedef std::shared_ptr<const GraphContext> CPtr;
 
+    /**
+     * @param paramsCache optional primitive cache shared with the other graphs (streams) of the compiled model, the
+     *        primitives which must not be executed concurrently are kept in the private cache of the graph anyway
+     * @param sharedSnippetsCache optional cache of the generated snippets kernels shared with the other graphs
+     *        (streams) of the compiled model, a private cache is created when it is not specified
+     */
     GraphContext(const Config& config,
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 MultiCachePtr paramsCache = nullptr,
+                 MultiCachePtr sharedSnippetsCache = nullptr)
         : config(config),
           extensionManager(extensionManager),
           weightsCache(w_cache),
+          snippetsCache(sharedSnippetsCache),
           isGraphQuantizedFlag(isGraphQuantized) {
-        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity, paramsCache);
+        if (!snippetsCache)
+            snippetsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+        if (!config.weightsCacheDir.empty())
+            weightsDiskCache = std::make_shared<WeightsDiskCache>(config.weightsCacheDir);
         rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
     }
 
@@ -42,11 +56,19 @@ public:
         return weightsCache;
     }
 
+    WeightsDiskCache::Ptr getWeightsDiskCache() const {
+        return weightsDiskCache;
+    }
+
 
     MultiCachePtr getParamsCache() const {
         return rtParamsCache;
     }
 
+    MultiCachePtr getSnippetsCache() const {
+        return snippetsCache;
+    }
+
     DnnlScratchPadPtr getScratchPad() const {
         return rtScratchPad;
     }
@@ -64,8 +86,10 @@ private:
 
     ExtensionManager::Ptr extensionManager;
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
+    WeightsDiskCache::Ptr weightsDiskCache;   // repacked weights persisted between the processes
 
     MultiCachePtr rtParamsCache;     // primitive cache
+    MultiCachePtr snippetsCache;     // generated snippets kernels
     DnnlScratchPadPtr rtScratchPad;  // scratch pad
 
     bool isGraphQuantizedFlag = false;
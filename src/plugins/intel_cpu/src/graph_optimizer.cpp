@@ -74,6 +74,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseConvMatmulFCDeconvAndDQScales(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseFCAndWeightsDecompression");
+    FuseFCAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionMatMulDeconvAndBias(graph);
     graph.RemoveDroppedNodes();
@@ -272,6 +276,127 @@ void GraphOptimizer::FuseConvMatmulFCDeconvAndDQScales(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
+    if (!node::FullyConnected::isWeightsDecompressionSupported())
+        return;
+
+    auto& graphNodes = graph.GetNodes();
+
+    auto getConstParent = [](const NodePtr& node, size_t port) -> NodePtr {
+        const auto parent = node->getParentEdgesAtPort(port)[0]->getParent();
+        return parent->getType() == Type::Input && parent->isConstant() ? parent : nullptr;
+    };
+
+    auto isSuitableEltwise = [](const NodePtr& node, Algorithm algorithm) {
+        return node->getType() == Type::Eltwise && node->getAlgorithm() == algorithm &&
+               node->getParentEdges().size() == 2 && node->getChildEdges().size() == 1 && node->getFusedWith().empty();
+    };
+
+    // the decompression constant is broadcasted to [OC, groups], its dims are aligned with the weights [OC, (groups,) IC]
+    auto expandConstant = [](const NodePtr& constNode, const VectorDims& weightsDims, std::vector<float>& values) {
+        if (constNode->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+        const auto dims = getNormalizedDimsBySize(constNode->getOutputShapeAtPort(0).getDims(), weightsDims.size());
+        const size_t OC = weightsDims[0];
+        const size_t groups = weightsDims.size() == 3 ? weightsDims[1] : 1;
+        const size_t constOC = dims[0];
+        const size_t constGroups = dims.size() == 3 ? dims[1] : 1;
+        if (dims.size() != weightsDims.size() || dims.back() != 1 ||
+            !one_of(constOC, 1u, OC) || !one_of(constGroups, 1u, groups))
+            return false;
+
+        auto memory = std::static_pointer_cast<node::Input>(constNode)->getMemoryPtr();
+        const auto data = static_cast<const float*>(memory->GetPtr());
+        values.resize(OC * groups);
+        for (size_t oc = 0; oc < OC; oc++) {
+            for (size_t g = 0; g < groups; g++)
+                values[oc * groups + g] = data[(constOC == 1 ? 0 : oc) * constGroups + (constGroups == 1 ? 0 : g)];
+        }
+        return true;
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        // Input [u8/i8] -> Convert -> (Subtract zero point) -> Multiply scale -> (Reshape) -> FullyConnected [weights]
+        const auto fcNode = std::dynamic_pointer_cast<node::FullyConnected>(graphNodes[i]);
+        if (!fcNode || !fcNode->getFusedWith().empty() ||
+            fcNode->getOriginalInputPrecisionAtPort(0) != Precision::FP32 ||
+            fcNode->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+        const auto& fcWeightsShape = fcNode->getInputShapeAtPort(1);
+        if (fcWeightsShape.getRank() != 2 || !fcWeightsShape.isStatic())
+            continue;
+
+        NodePtr reshapeNode;
+        NodePtr multiplyNode = fcNode->getParentEdgesAtPort(1)[0]->getParent();
+        if (multiplyNode->getType() == Type::Reshape && multiplyNode->getChildEdges().size() == 1) {
+            reshapeNode = multiplyNode;
+            multiplyNode = reshapeNode->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        if (!isSuitableEltwise(multiplyNode, Algorithm::EltwiseMultiply))
+            continue;
+        const size_t scalePort = getConstParent(multiplyNode, 1) ? 1 : 0;
+        const auto scaleNode = getConstParent(multiplyNode, scalePort);
+        if (!scaleNode)
+            continue;
+
+        NodePtr subtractNode;
+        NodePtr convertNode = multiplyNode->getParentEdgesAtPort(1 - scalePort)[0]->getParent();
+        if (isSuitableEltwise(convertNode, Algorithm::EltwiseSubtract) && getConstParent(convertNode, 1)) {
+            subtractNode = convertNode;
+            convertNode = subtractNode->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        if (convertNode->getType() != Type::Convert || convertNode->getChildEdges().size() != 1 ||
+            convertNode->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+        const auto weightsNode = getConstParent(convertNode, 0);
+        if (!weightsNode)
+            continue;
+        const auto weightsPrecision = weightsNode->getOriginalOutputPrecisionAtPort(0);
+        if (!one_of(weightsPrecision, Precision::U8, Precision::I8))
+            continue;
+
+        // the weights are either [OC, IC] or grouped [OC, groups, group size] and reshaped to [OC, IC]
+        const auto& fcWeightsDims = fcWeightsShape.getStaticDims();
+        const auto& weightsShape = convertNode->getOutputShapeAtPort(0);
+        if (!weightsShape.isStatic() || !one_of(weightsShape.getRank(), 2u, 3u) ||
+            (weightsShape.getRank() == 3 && !reshapeNode))
+            continue;
+        const auto& weightsDims = weightsShape.getStaticDims();
+        if (weightsDims[0] != fcWeightsDims[0] || weightsShape.getElementsCount() != fcWeightsShape.getElementsCount())
+            continue;
+
+        std::vector<float> scales, zeroPoints;
+        if (!expandConstant(scaleNode, weightsDims, scales) ||
+            (subtractNode && !expandConstant(getConstParent(subtractNode, 1), weightsDims, zeroPoints)))
+            continue;
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseFCAndWeightsDecompression);
+        DEBUG_LOG("GraphOptimizer##FuseFCAndWeightsDecompression: weights of Node ##", fcNode->getName(),
+                  " are kept in ", weightsPrecision.name());
+
+        const size_t groups = weightsDims.size() == 3 ? weightsDims[1] : 1;
+        fcNode->fuseWeightsDecompression(std::move(scales), std::move(zeroPoints), groups);
+        fcNode->setOriginalInputPrecisionAtPort(1, weightsPrecision);
+        if (reshapeNode) {
+            reshapeNode->setOriginalInputPrecisionAtPort(0, weightsPrecision);
+            reshapeNode->setOriginalOutputPrecisionAtPort(0, weightsPrecision);
+        }
+
+        fcNode->addOriginalLayer(multiplyNode->getOriginalLayers());
+        auto scaleEdge = multiplyNode->getParentEdgesAtPort(scalePort)[0];
+        graph.RemoveEdge(scaleEdge);
+        graph.DropNode(multiplyNode);
+        if (subtractNode) {
+            fcNode->addOriginalLayer(subtractNode->getOriginalLayers());
+            auto zeroPointEdge = subtractNode->getParentEdgesAtPort(1)[0];
+            graph.RemoveEdge(zeroPointEdge);
+            graph.DropNode(subtractNode);
+        }
+        fcNode->addOriginalLayer(convertNode->getOriginalLayers());
+        graph.DropNode(convertNode);
+    }
+}
+
 void GraphOptimizer::FuseConvolutionMatMulDeconvAndBias(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -56,7 +56,7 @@ void InferRequestBase::CreateInferRequest() {
             if (suffix_idx != std::string::npos)
                 state_name = state_name.substr(0, suffix_idx);
 
-            memoryStates.emplace_back(new VariableState(state_name, state_store));
+            memoryStates.emplace_back(new VariableState(state_name, state_store, memoryNode->isDynamicNode()));
         }
     }
 }
@@ -102,12 +102,11 @@ void InferRequestBase::PushStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<VariableState>(state);
+                    if (!cur_state) {
+                        IE_THROW() << "Cannot cast state " << cur_id << " to VariableState";
+                    }
+                    cur_node->bindStates(cur_state->getCurrent(), cur_state->getNext());
                 }
             }
         }
@@ -121,15 +120,13 @@ void InferRequestBase::PullStates() {
             if (!cur_node) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
             }
+            // the state isn't changed if there is no Assign for the variable
+            if (!cur_node->isStateStored())
+                continue;
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    std::static_pointer_cast<VariableState>(state)->commit();
                 }
             }
         }
@@ -154,6 +151,8 @@ void InferRequestBase::InferImpl() {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, profilingTask);
     auto graphLock = execNetwork->GetGraph();
     graph = &(graphLock._graph);
+    // must be bound before the external pointers are applied, since the pooled tensors are rebound to the arena
+    Graph::WorkspaceGuard workspaceGuard(*graph);
 
     ThrowIfCanceled();
     convertBatchedInputBlobs();
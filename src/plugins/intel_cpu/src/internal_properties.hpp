@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for CPU plugin specific properties which are not a part of the public API yet
+ * @file internal_properties.hpp
+ */
+
+#pragma once
+
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Enables concurrent execution of independent nodes of a static graph.
+ *
+ * The executable nodes are split into levels of the dependency DAG built from the graph edges (including memory
+ * sharing hazards), and the nodes of one level are dispatched in parallel inside the stream. Intermediate memory
+ * reuse is planned on the level timeline, so the mode may slightly increase the memory footprint.
+ */
+static constexpr Property<bool> parallel_nodes_execution{"CPU_PARALLEL_NODES_EXECUTION"};
+
+/**
+ * @brief Makes all the streams of a compiled model use one thread safe runtime (primitives) cache instead of a cache per
+ * stream, so the primitives created by one stream for a dynamic shape are reused by the others.
+ */
+static constexpr Property<bool> shared_runtime_cache{"CPU_SHARED_RUNTIME_CACHE"};
+
+/**
+ * @brief Makes the streams of a compiled model take the memory for the intermediate tensors from a shared pool of
+ * arenas only while they execute an inference, instead of holding a private arena per stream.
+ *
+ * The number of the allocated arenas follows the number of the concurrently executing streams, which reduces the
+ * memory footprint when there are many more streams than requests in flight. The constant tensors are not pooled.
+ */
+static constexpr Property<bool> shared_workspace{"CPU_SHARED_WORKSPACE"};
+
+/**
+ * @brief Read-only property of a compiled model to get the runtime cache lookup statistics accumulated over all the
+ * streams: the number of "hits", "misses" and "evictions".
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Read-only property of a compiled model to get the lookup statistics of the generated snippets kernels cache
+ * shared by all the streams: the number of "hits", "misses" and "evictions".
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> snippets_cache_statistics{
+    "CPU_SNIPPETS_CACHE_STATISTICS"};
+
+/**
+ * @brief Directory to persist the weights repacked to the CPU specific layouts.
+ *
+ * The repacked weights are stored as separate files keyed by the weights content and layout, and are memory mapped on
+ * the next compilation or import of the same model instead of being reordered again. It is supposed to be set along
+ * with ov::cache_dir (the same directory may be used), since the imported blob keeps the original weights only.
+ */
+static constexpr Property<std::string> weights_cache_dir{"CPU_WEIGHTS_CACHE_DIR"};
+
+/**
+ * @brief Binds the weights cached per NUMA node to the memory of that node.
+ *
+ * The streams of a multi-stream compiled model keep a copy of the weights per NUMA node. By default the pages are
+ * placed by the first touch, which happens on a thread of the stream creating the weights. In this mode the pages are
+ * explicitly moved to the node of the cache, so the placement doesn't depend on the threads affinity.
+ * Supported on Linux only, ignored on the other platforms.
+ */
+static constexpr Property<bool> numa_weights_binding{"CPU_NUMA_WEIGHTS_BINDING"};
+
+/**
+ * @brief Read-only property of a compiled model to get the size in bytes of the weights cached per NUMA node, the keys
+ * are the node ids. The weights are cached for the models with more than one stream only.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> weights_memory_statistics{
+    "CPU_WEIGHTS_MEMORY_STATISTICS"};
+
+}  // namespace intel_cpu
+}  // namespace ov
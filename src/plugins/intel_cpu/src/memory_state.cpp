@@ -11,10 +11,71 @@ using namespace InferenceEngine;
 namespace ov {
 namespace intel_cpu {
 
+VariableState::VariableState(std::string name, MemoryPtr storage, bool resizable)
+    : InferenceEngine::IVariableStateInternal{name}, resizable(resizable), initialDims(storage->getStaticDims()) {
+    for (size_t i = 0; i < 2; i++) {
+        buffers[i] = std::make_shared<Memory>(storage->getEngine());
+        buffers[i]->Create(storage->getDesc());
+        updateView(i);
+    }
+    if (storage->GetSize() != 0)
+        cpu_memcpy(buffers[current]->GetData(), storage->GetData(), storage->GetSize());
+}
+
+void VariableState::redefineBuffer(Memory& buffer, const VectorDims& dims) {
+    auto desc = buffer.getDescPtr()->cloneWithNewDims(dims, true);
+    size_t capacity = 1;
+    while (capacity < desc->getCurrentMemSize())
+        capacity <<= 1;
+    buffer.getDnnlMemoryMngr()->resize(capacity);
+    buffer.redefineDesc(desc);
+}
+
+void VariableState::updateView(size_t idx) {
+    const auto& buffer = buffers[idx];
+    if (!views[idx] || views[idx]->getTensorDesc().getDims() != buffer->getStaticDims() ||
+        views[idx]->cbuffer().as<const void*>() != buffer->GetData()) {
+        views[idx] = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(buffer->getDesc()), buffer->GetData());
+    }
+    if (idx == current)
+        state = views[idx];
+}
+
 void VariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    if (resizable && buffers[current]->getStaticDims() != initialDims) {
+        redefineBuffer(*buffers[current], initialDims);
+        updateView(current);
+    }
+    if (state->byteSize() != 0)
+        std::memset(state->buffer(), 0, state->byteSize());
+}
+
+void VariableState::SetState(const Blob::Ptr& newState) {
+    if (!newState)
+        IE_THROW() << "Variable state " << name << " can't be set from an empty blob";
+    const auto& dims = newState->getTensorDesc().getDims();
+    if (resizable && buffers[current]->getStaticDims() != dims) {
+        redefineBuffer(*buffers[current], dims);
+        updateView(current);
+    }
+    if (newState->byteSize() != state->byteSize())
+        IE_THROW() << "Variable state " << name << " can't be set from a blob of a different size";
+    if (state->byteSize() != 0)
+        cpu_memcpy(state->buffer(), newState->cbuffer().as<const void*>(), state->byteSize());
+}
+
+Blob::CPtr VariableState::GetState() const {
+    auto snapshot = make_blob_with_precision(state->getTensorDesc());
+    snapshot->allocate();
+    if (state->byteSize() != 0)
+        cpu_memcpy(snapshot->buffer(), state->cbuffer().as<const void*>(), state->byteSize());
+    return snapshot;
+}
+
+void VariableState::commit() {
+    current = 1 - current;
+    updateView(current);
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
@@ -15,16 +15,46 @@
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * Double buffered state of a variable.
+ * ReadValue reads the current buffer and Assign writes the next one directly, so the buffers are only swapped after
+ * the inference instead of the state being copied from and to the graph. Since a buffer is overwritten by every second
+ * inference, GetState returns a copy of the current buffer, which isn't changed by the following inferences.
+ * The state of a dynamic shape is resizable, it starts from the lower bounds of its dims. The buffers keep their
+ * capacity, but the state isn't appended in place: ReadValue still copies the whole state to the graph and Assign copies
+ * the whole new state to the next buffer.
+ */
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
-    }
+    VariableState(std::string name, MemoryPtr storage, bool resizable = false);
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    /**
+     * Redefines the dims of a state buffer. The capacity is rounded up to a power of two, so a state growing step by step
+     * (e.g. a history of frames or tokens) is reallocated a logarithmic number of times. The data isn't preserved.
+     */
+    static void redefineBuffer(Memory& buffer, const VectorDims& dims);
+
+    MemoryPtr getCurrent() const {
+        return buffers[current];
+    }
+    MemoryPtr getNext() const {
+        return buffers[1 - current];
+    }
+    // makes the next buffer current one, is called after the inference which has written the next buffer
+    void commit();
+
+private:
+    void updateView(size_t idx);
+
+    MemoryPtr buffers[2];
+    InferenceEngine::Blob::Ptr views[2];
+    size_t current = 0;
+    bool resizable;
+    VectorDims initialDims;
 };
 
 }   // namespace intel_cpu
@@ -797,7 +797,7 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
 
     const auto &internalBlob = internalBlobs[indx];
 
-    auto create = [&] () {
+    auto reorder = [&] () {
         // TODO [DS]: internal blobs should be removed or rewritten using Memory object
         auto newDesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(internalBlob->getTensorDesc());
 
@@ -810,6 +810,22 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
         return _ptr;
     };
 
+    auto create = [&] () {
+        auto diskCache = context->getWeightsDiskCache();
+        const auto& layout = diskCache ? WeightsDiskCache::describe(intDesc) : std::string{};
+        if (layout.empty())
+            return reorder();
+
+        const auto& srcDesc = internalBlob->getTensorDesc();
+        const uint64_t data_hash = WeightsSharing::GetHashFunc().hash(
+                internalBlob->buffer(), internalBlob->byteSize());
+        const std::string key = std::string("blob_") + srcDesc.getPrecision().name()
+                                + "_" + std::to_string(internalBlob->byteSize())
+                                + "_" + std::to_string(data_hash)
+                                + "_" + layout;
+        return diskCache->findOrCreate(key, intDesc, engine, reorder);
+    };
+
     MemoryPtr ptr;
     auto weightCache = context->getWeightsCache();
     if (weightCache != nullptr && memory::format_kind::blocked == intDesc->getDnnlDesc().get_format_kind()) {
@@ -860,7 +876,7 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
     auto constDnnlMemOutDesc = edgeMem->GetDescWithType<DnnlMemoryDesc>();
     auto weightSrcDesc = constDnnlMemOutDesc->getDnnlDesc();
     weightSrcDesc = weightSrcDesc.reshape(weightDesc->getDnnlDesc().get_dims());
-    auto create = [&] () {
+    auto reorder = [&] () {
         auto newSrcDesc = DnnlExtensionUtils::makeDescriptor(weightSrcDesc);
 
         Memory srcMemory{ getEngine() };
@@ -873,6 +889,23 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
         return _ptr;
     };
 
+    auto create = [&] () {
+        auto diskCache = context->getWeightsDiskCache();
+        const auto& layout = diskCache ? WeightsDiskCache::describe(weightDesc) : std::string{};
+        const auto& srcLayout = diskCache ? WeightsDiskCache::describe(DnnlExtensionUtils::makeDescriptor(weightSrcDesc))
+                                          : std::string{};
+        if (layout.empty() || srcLayout.empty())
+            return reorder();
+
+        // unlike the in-memory cache the key must not depend on the data address, so the content is hashed
+        const uint64_t data_hash = WeightsSharing::GetHashFunc().hash(
+                static_cast<const unsigned char*>(edgeMem->GetData()), edgeMem->GetSize());
+        const std::string key = "weights_" + srcLayout
+                                + "_" + std::to_string(data_hash)
+                                + "_" + layout;
+        return diskCache->findOrCreate(key, weightDesc, getEngine(), reorder);
+    };
+
     MemoryPtr ptr;
     const auto& format = weightDesc->serializeFormat();
     auto itr = privateWeightCache.find(format);
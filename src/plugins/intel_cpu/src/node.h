@@ -269,6 +269,14 @@ public:
         this->fusingPort = fusingPort;
     }
 
+    /**
+     * @brief Marks the node as executed concurrently with the other nodes of its graph, so it can't use the scratchpad
+     * shared across the graph. Must be set before the primitives creation.
+     */
+    void setConcurrentExecution(bool concurrent) {
+        concurrentExecution = concurrent;
+    }
+
     const std::string &getName() const {
         return name;
     }
@@ -682,7 +690,13 @@ protected:
 
     MemoryPtr getScratchPadMem(const DnnlMemoryDescPtr& desc) {
         if (!scratchpadMem || !scratchpadMem->getDesc().isCompatible(*desc)) {
-            scratchpadMem = context->getScratchPad()->createScratchPadMem(desc);
+            if (concurrentExecution) {
+                // nodes may be executed concurrently, so the scratchpad can't be shared across the graph
+                scratchpadMem = std::make_shared<Memory>(getEngine());
+                scratchpadMem->Create(desc);
+            } else {
+                scratchpadMem = context->getScratchPad()->createScratchPadMem(desc);
+            }
         }
         return scratchpadMem;
     }
@@ -713,6 +727,7 @@ private:
     PerfCounters profiling;
 
     MemoryPtr scratchpadMem;
+    bool concurrentExecution = false;
 
     bool isEdgesEmpty(const std::vector<EdgeWeakPtr>& edges) const;
 
@@ -691,6 +691,9 @@ struct DefConvKey {
     DeformableConvolution::DefConvAttr defConvAttr;
     impl_desc_type implType;
 
+    // the executors keep the sampling buffers of the current execution
+    static constexpr bool sharedCacheAllowed = false;
+
     size_t hash() const;
     bool operator==(const DefConvKey& rhs) const;
 };
@@ -25,7 +25,15 @@
 #include "common/primitive_hashing_utils.hpp"
 #include "common/primitive_desc.hpp"
 #include "common/primitive_desc_iface.hpp"
+#include "ie_parallel.hpp"
+#include "weights_cache.hpp"
+#if defined(OPENVINO_ARCH_X86_64)
+#include "kernels/x64/sparse_fc_kernel.hpp"
+#include "kernels/x64/weights_decompression_fc_kernel.hpp"
+#endif
 
+#include <cassert>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -134,6 +142,59 @@ private:
     std::shared_ptr<const ngraph::Node> m_op;
 };
 
+#if defined(OPENVINO_ARCH_X86_64)
+/**
+ * Runs a jit FC kernel over the tiles of the rows of the source and the blocks of the output channels in parallel.
+ * The kernel computes maxRows rows of one block, the rows of the last incomplete tile are computed one by one by
+ * kernelRow. setBlockArgs fills the weights related arguments of a block. The tail block is computed to the local
+ * buffer, since the kernels store the whole vectors, so maxTileSize must fit the largest block of the biggest tile.
+ */
+template <size_t maxTileSize, typename Kernel, typename Args, typename SetBlockArgs>
+void executeRowTiles(Kernel& kernel,
+                     Kernel& kernelRow,
+                     const float* src,
+                     float* dst,
+                     size_t M,
+                     size_t IC,
+                     size_t OC,
+                     size_t blockSize,
+                     const SetBlockArgs& setBlockArgs) {
+    const size_t maxRows = kernel.rows_;
+    const size_t S = blockSize;
+    assert(maxRows * S <= maxTileSize);
+
+    parallel_for2d(div_up(M, maxRows), div_up(OC, S), [&](size_t tile, size_t b) {
+        const size_t rowStart = tile * maxRows;
+        const size_t rows = std::min(maxRows, M - rowStart);
+        const bool isTail = (b + 1) * S > OC;
+        float tailBuffer[maxTileSize];
+
+        Args args;
+        setBlockArgs(args, b);
+        args.src_stride = IC * sizeof(float);
+        args.dst_stride = (isTail ? S : OC) * sizeof(float);
+
+        auto computeRows = [&](Kernel& rowsKernel, size_t row) {
+            args.src = src + (rowStart + row) * IC;
+            args.dst = isTail ? tailBuffer + row * S : dst + (rowStart + row) * OC + b * S;
+            rowsKernel(&args);
+        };
+
+        if (rows == maxRows) {
+            computeRows(kernel, 0);
+        } else {
+            for (size_t row = 0; row < rows; row++)
+                computeRows(kernelRow, row);
+        }
+
+        if (isTail) {
+            for (size_t row = 0; row < rows; row++)
+                std::copy_n(tailBuffer + row * S, OC - b * S, dst + (rowStart + row) * OC + b * S);
+        }
+    });
+}
+#endif
+
 } // namespace
 
 bool FullyConnected::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
@@ -235,7 +296,13 @@ void FullyConnected::getSupportedDescriptors() {
 
     withBiases = getOriginalInputsNumber() == 3;
 
+    if (useWeightsDecompression)
+        return;
+
     useSparseWeights = useSparseWeightsDecompression();
+    useBlockSparseWeights = useBlockSparseWeightsKernel();
+    if (useBlockSparseWeights)
+        return;
 
     auto inputDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
     outputDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(DATA_ID));
@@ -285,6 +352,16 @@ void FullyConnected::getSupportedDescriptors() {
 }
 
 void FullyConnected::createPrimitive() {
+    if (useBlockSparseWeights) {
+        packBlockSparseWeights();
+        Node::createPrimitive();
+        return;
+    }
+    if (useWeightsDecompression) {
+        packDecompressedWeights();
+        Node::createPrimitive();
+        return;
+    }
     setPostOps(attr, outDims);
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     Node::createPrimitive();
@@ -292,6 +369,10 @@ void FullyConnected::createPrimitive() {
 }
 
 void FullyConnected::prepareParams() {
+    // the own kernels read the shapes from the memory on every execution
+    if (useBlockSparseWeights || useWeightsDecompression)
+        return;
+
     auto srcMemPtr = getParentEdgesAtPort(0)[0]->getMemoryPtr();
     auto dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
     if (!dstMemPtr || !dstMemPtr->isAllocated())
@@ -435,6 +516,15 @@ void FullyConnected::prepareParams() {
 }
 
 void FullyConnected::execute(dnnl::stream strm) {
+    if (useBlockSparseWeights) {
+        executeBlockSparse();
+        return;
+    }
+    if (useWeightsDecompression) {
+        executeWeightsDecompression();
+        return;
+    }
+
     if (!execPtr) {
         IE_THROW() << "Can't execute FullyConnected node with name: " << getName() << ", because executor is not compiled";
     }
@@ -464,6 +554,9 @@ void FullyConnected::executeDynamicImpl(dnnl::stream strm) {
 }
 
 bool FullyConnected::canFuse(const NodePtr& node) const {
+    // the weights decompression kernel doesn't support post ops
+    if (useWeightsDecompression)
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -649,6 +742,25 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (useWeightsDecompression) {
+        std::vector<PortConfigurator> inConfs(descInputNumbers(), {LayoutType::ncsp, Precision::FP32});
+        inConfs[WEIGHTS_ID] = {LayoutType::ncsp, getOriginalInputPrecisionAtPort(WEIGHTS_ID)};
+        addSupportedPrimDesc(inConfs,
+                             {{LayoutType::ncsp, Precision::FP32}},
+                             impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core) ? impl_desc_type::jit_avx512
+                                                                                   : impl_desc_type::jit_avx2);
+        return;
+    }
+
+    if (useBlockSparseWeights) {
+        std::vector<PortConfigurator> inConfs(descInputNumbers(), {LayoutType::ncsp, Precision::FP32});
+        addSupportedPrimDesc(inConfs,
+                             {{LayoutType::ncsp, Precision::FP32}},
+                             impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core) ? impl_desc_type::jit_avx512
+                                                                                   : impl_desc_type::jit_avx2);
+        return;
+    }
+
     // 3D FC requires implicit reshape so strides should be defined
     auto supportsUndefStridesAndOffset = [&]() {
         return getOutputShapeAtPort(0).getRank() == 2;
@@ -747,6 +859,8 @@ InferenceEngine::Precision FullyConnected::getRuntimePrecision() const {
 
 void FullyConnected::initOptimalPrimitiveDescriptor() {
     Node::initOptimalPrimitiveDescriptor();
+    if (useBlockSparseWeights || useWeightsDecompression)
+        return;
     auto selectedPD = getSelectedPrimitiveDescriptor();
     implementationTypeIP = selectedPD->getImplementationType();
     // if convolution selected the reorder for ip is useless. Will do the reoder for ip in prepareParams
@@ -922,6 +1036,302 @@ bool FullyConnected::useSparseWeightsDecompression() {
 
     return true;
 }
+
+bool FullyConnected::useBlockSparseWeightsKernel() {
+#if defined(OPENVINO_ARCH_X86_64)
+    // minSparseRate == 1 means that sparse feature is switched off
+    if (minSparseRate == 1.f) {
+        return false;
+    }
+
+    if (impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core)) {
+        sparseBlockSize = jit_sparse_fc_kernel_f32<impl::cpu::x64::avx512_core>::block_size;
+    } else if (impl::cpu::x64::mayiuse(impl::cpu::x64::avx2)) {
+        sparseBlockSize = jit_sparse_fc_kernel_f32<impl::cpu::x64::avx2>::block_size;
+    } else {
+        return false;
+    }
+
+    // the kernel doesn't support post ops
+    if (!fusedWith.empty())
+        return false;
+
+    if (getOriginalInputPrecisionAtPort(DATA_ID) != Precision::FP32 ||
+        getOriginalInputPrecisionAtPort(WEIGHTS_ID) != Precision::FP32 ||
+        getOriginalOutputPrecisionAtPort(0) != Precision::FP32 ||
+        (withBiases && getOriginalInputPrecisionAtPort(BIAS_ID) != Precision::FP32)) {
+        return false;
+    }
+
+    const auto& weiDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const auto inRank = getInputShapeAtPort(DATA_ID).getRank();
+    if (weiDims.size() != 2 || !one_of(inRank, 2u, 3u)) {
+        return false;
+    }
+
+    const auto constNode = std::dynamic_pointer_cast<Input>(getParentEdgeAt(WEIGHTS_ID)->getParent());
+    if (!constNode) {
+        return false;
+    }
+    // the bias is usually flattened by the constant Reshape, which is executed before the primitive is created
+    if (withBiases && !getParentEdgeAt(BIAS_ID)->getParent()->isConstant()) {
+        return false;
+    }
+    auto blb = constNode->getMemoryPtr();
+    if (blb == nullptr)
+        IE_THROW() << "Cannot get const blob for node " << getName() << ".";
+
+    // the sparsity is measured in the (sparseBlockSize x 1) blocks of the output channels, which are skipped entirely
+    const auto weightsData = reinterpret_cast<const float*>(blb->GetPtr());
+    const size_t OC = weiDims[0];
+    const size_t IC = weiDims[1];
+    const size_t blocksNum = div_up(OC, sparseBlockSize);
+    size_t zeroColumns = 0;
+    for (size_t b = 0; b < blocksNum; b++) {
+        const size_t ocEnd = std::min(OC, (b + 1) * sparseBlockSize);
+        for (size_t ic = 0; ic < IC; ic++) {
+            bool isZero = true;
+            for (size_t oc = b * sparseBlockSize; oc < ocEnd && isZero; oc++)
+                isZero = weightsData[oc * IC + ic] == 0.f;
+            zeroColumns += isZero;
+        }
+    }
+
+    const float blockSparseRate = static_cast<float>(zeroColumns) / static_cast<float>(blocksNum * IC);
+
+    DEBUG_LOG(getName(), " | block ", sparseBlockSize, "x1 sparse rate = ", blockSparseRate * 100, "%, min sparse rate = ",
+        minSparseRate * 100, "%, use block sparse weights = ", blockSparseRate >= minSparseRate);
+
+    return blockSparseRate >= minSparseRate;
+#else
+    return false;
+#endif
+}
+
+void FullyConnected::packBlockSparseWeights() {
+#if defined(OPENVINO_ARCH_X86_64)
+    auto weiMemPtr = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    if (!weiMemPtr || !weiMemPtr->isAllocated())
+        IE_THROW() << errorPrefix << " has unallocated weights memory";
+
+    const auto weightsData = reinterpret_cast<const float*>(weiMemPtr->GetPtr());
+    const auto& weiDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t OC = weiDims[0];
+    const size_t IC = weiDims[1];
+    const size_t blocksNum = div_up(OC, sparseBlockSize);
+
+    sparseValues.clear();
+    sparseOffsets.clear();
+    sparseBlockStarts.assign(1, 0);
+    for (size_t b = 0; b < blocksNum; b++) {
+        const size_t ocStart = b * sparseBlockSize;
+        const size_t ocEnd = std::min(OC, ocStart + sparseBlockSize);
+        for (size_t ic = 0; ic < IC; ic++) {
+            bool isZero = true;
+            for (size_t oc = ocStart; oc < ocEnd && isZero; oc++)
+                isZero = weightsData[oc * IC + ic] == 0.f;
+            if (isZero)
+                continue;
+
+            for (size_t oc = ocStart; oc < ocStart + sparseBlockSize; oc++)
+                sparseValues.push_back(oc < ocEnd ? weightsData[oc * IC + ic] : 0.f);
+            sparseOffsets.push_back(static_cast<int64_t>(ic * sizeof(float)));
+        }
+        sparseBlockStarts.push_back(sparseOffsets.size());
+    }
+
+    sparseBias.assign(blocksNum * sparseBlockSize, 0.f);
+    if (withBiases) {
+        auto biasMemPtr = getParentEdgeAt(BIAS_ID)->getMemoryPtr();
+        if (!biasMemPtr || !biasMemPtr->isAllocated())
+            IE_THROW() << errorPrefix << " has unallocated bias memory";
+        const auto biasData = reinterpret_cast<const float*>(biasMemPtr->GetPtr());
+        std::copy(biasData, biasData + OC, sparseBias.begin());
+    }
+
+    if (sparseBlockSize == jit_sparse_fc_kernel_f32<impl::cpu::x64::avx512_core>::block_size) {
+        sparseKernel = std::make_shared<jit_sparse_fc_kernel_f32<impl::cpu::x64::avx512_core>>(
+            jit_sparse_fc_kernel_f32<impl::cpu::x64::avx512_core>::max_rows);
+        sparseKernelRow = std::make_shared<jit_sparse_fc_kernel_f32<impl::cpu::x64::avx512_core>>(1);
+    } else {
+        sparseKernel = std::make_shared<jit_sparse_fc_kernel_f32<impl::cpu::x64::avx2>>(
+            jit_sparse_fc_kernel_f32<impl::cpu::x64::avx2>::max_rows);
+        sparseKernelRow = std::make_shared<jit_sparse_fc_kernel_f32<impl::cpu::x64::avx2>>(1);
+    }
+    sparseKernel->create_ker();
+    sparseKernelRow->create_ker();
+
+    DEBUG_LOG(getName(), " | block sparse weights: ", sparseOffsets.size(), " non-zero columns of ", blocksNum * IC);
+#else
+    IE_THROW() << errorPrefix << " doesn't support block sparse weights on this platform";
+#endif
+}
+
+void FullyConnected::executeBlockSparse() {
+#if defined(OPENVINO_ARCH_X86_64)
+    using avx512_kernel = jit_sparse_fc_kernel_f32<impl::cpu::x64::avx512_core>;
+
+    const auto srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
+    const auto dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const auto& srcDims = srcMemPtr->getStaticDims();
+    const size_t IC = srcDims.back();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    const size_t OC = dstMemPtr->getStaticDims().back();
+    const size_t S = sparseBlockSize;
+
+    executeRowTiles<avx512_kernel::block_size * avx512_kernel::max_rows, jit_sparse_fc_kernel, jit_sparse_fc_args>(
+        *sparseKernel,
+        *sparseKernelRow,
+        reinterpret_cast<const float*>(srcMemPtr->GetPtr()),
+        reinterpret_cast<float*>(dstMemPtr->GetPtr()),
+        M,
+        IC,
+        OC,
+        S,
+        [&](jit_sparse_fc_args& args, size_t b) {
+            args.weights = sparseValues.data() + sparseBlockStarts[b] * S;
+            args.offsets = sparseOffsets.data() + sparseBlockStarts[b];
+            args.bias = sparseBias.data() + b * S;
+            args.blocks_num = sparseBlockStarts[b + 1] - sparseBlockStarts[b];
+        });
+#endif
+}
+
+bool FullyConnected::isWeightsDecompressionSupported() {
+#if defined(OPENVINO_ARCH_X86_64)
+    return impl::cpu::x64::mayiuse(impl::cpu::x64::avx2);
+#else
+    return false;
+#endif
+}
+
+void FullyConnected::fuseWeightsDecompression(std::vector<float> scales, std::vector<float> zeroPoints, size_t groups) {
+    decompressionScales = std::move(scales);
+    decompressionZeroPoints = std::move(zeroPoints);
+    decompressionGroups = groups;
+    useWeightsDecompression = true;
+}
+
+void FullyConnected::packDecompressedWeights() {
+#if defined(OPENVINO_ARCH_X86_64)
+    auto weiMemPtr = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    if (!weiMemPtr || !weiMemPtr->isAllocated())
+        IE_THROW() << errorPrefix << " has unallocated weights memory";
+
+    const auto& weiDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t OC = weiDims[0];
+    const size_t IC = weiDims[1];
+    if (IC % decompressionGroups != 0 || decompressionScales.size() != OC * decompressionGroups ||
+        (!decompressionZeroPoints.empty() && decompressionZeroPoints.size() != OC * decompressionGroups))
+        IE_THROW() << errorPrefix << " has inconsistent weights decompression parameters";
+
+    const bool isAvx512 = impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core);
+    decompressionBlockSize = isAvx512 ? jit_weights_decompression_fc_kernel_f32<impl::cpu::x64::avx512_core>::block_size
+                                      : jit_weights_decompression_fc_kernel_f32<impl::cpu::x64::avx2>::block_size;
+    const size_t S = decompressionBlockSize;
+    const size_t G = decompressionGroups;
+    const size_t blocksNum = div_up(OC, S);
+
+    // the output channels of a block are interleaved to be loaded by one vector for every input channel
+    auto create = [&]() {
+        const auto weightsData = reinterpret_cast<const uint8_t*>(weiMemPtr->GetPtr());
+        auto packed = std::make_shared<Memory>(getEngine());
+        packed->Create(DnnlBlockedMemoryDesc(Precision::U8, Shape(VectorDims{blocksNum * IC * S})));
+        auto packedData = reinterpret_cast<uint8_t*>(packed->GetPtr());
+        parallel_for(blocksNum, [&](size_t b) {
+            for (size_t ic = 0; ic < IC; ic++) {
+                for (size_t s = 0; s < S; s++) {
+                    const size_t oc = b * S + s;
+                    packedData[(b * IC + ic) * S + s] = oc < OC ? weightsData[oc * IC + ic] : 0;
+                }
+            }
+        });
+        return packed;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_decompressed_" + std::to_string(S)
+                                        + "_" + std::to_string(weiMemPtr->GetSize())
+                                        + "_" + std::to_string(reinterpret_cast<uint64_t>(weiMemPtr->GetData()));
+        decompressionWeights = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        decompressionWeights = create();
+    }
+
+    decompressionPackedScales.assign(blocksNum * G * S, 0.f);
+    decompressionPackedZeroPoints.assign(blocksNum * G * S, 0.f);
+    for (size_t oc = 0; oc < OC; oc++) {
+        for (size_t g = 0; g < G; g++) {
+            const size_t packedIdx = ((oc / S) * G + g) * S + oc % S;
+            decompressionPackedScales[packedIdx] = decompressionScales[oc * G + g];
+            if (!decompressionZeroPoints.empty())
+                decompressionPackedZeroPoints[packedIdx] = decompressionZeroPoints[oc * G + g];
+        }
+    }
+
+    decompressionBias.assign(blocksNum * S, 0.f);
+    if (withBiases) {
+        auto biasMemPtr = getParentEdgeAt(BIAS_ID)->getMemoryPtr();
+        if (!biasMemPtr || !biasMemPtr->isAllocated())
+            IE_THROW() << errorPrefix << " has unallocated bias memory";
+        const auto biasData = reinterpret_cast<const float*>(biasMemPtr->GetPtr());
+        std::copy(biasData, biasData + OC, decompressionBias.begin());
+    }
+
+    const bool signedWeights = getOriginalInputPrecisionAtPort(WEIGHTS_ID) == Precision::I8;
+    using avx512_kernel = jit_weights_decompression_fc_kernel_f32<impl::cpu::x64::avx512_core>;
+    using avx2_kernel = jit_weights_decompression_fc_kernel_f32<impl::cpu::x64::avx2>;
+    if (isAvx512) {
+        decompressionKernel = std::make_shared<avx512_kernel>(avx512_kernel::max_rows, signedWeights);
+        decompressionKernelRow = std::make_shared<avx512_kernel>(1, signedWeights);
+    } else {
+        decompressionKernel = std::make_shared<avx2_kernel>(avx2_kernel::max_rows, signedWeights);
+        decompressionKernelRow = std::make_shared<avx2_kernel>(1, signedWeights);
+    }
+    decompressionKernel->create_ker();
+    decompressionKernelRow->create_ker();
+#else
+    IE_THROW() << errorPrefix << " doesn't support weights decompression on this platform";
+#endif
+}
+
+void FullyConnected::executeWeightsDecompression() {
+#if defined(OPENVINO_ARCH_X86_64)
+    using avx512_kernel = jit_weights_decompression_fc_kernel_f32<impl::cpu::x64::avx512_core>;
+
+    const auto srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
+    const auto dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const auto weights = reinterpret_cast<const uint8_t*>(decompressionWeights->GetPtr());
+    const auto& srcDims = srcMemPtr->getStaticDims();
+    const size_t IC = srcDims.back();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    const size_t OC = dstMemPtr->getStaticDims().back();
+    const size_t S = decompressionBlockSize;
+    const size_t G = decompressionGroups;
+
+    executeRowTiles<avx512_kernel::block_size * avx512_kernel::max_rows,
+                    jit_weights_decompression_fc_kernel,
+                    jit_weights_decompression_fc_args>(
+        *decompressionKernel,
+        *decompressionKernelRow,
+        reinterpret_cast<const float*>(srcMemPtr->GetPtr()),
+        reinterpret_cast<float*>(dstMemPtr->GetPtr()),
+        M,
+        IC,
+        OC,
+        S,
+        [&](jit_weights_decompression_fc_args& args, size_t b) {
+            args.weights = weights + b * IC * S;
+            args.scales = decompressionPackedScales.data() + b * G * S;
+            args.zero_points = decompressionPackedZeroPoints.data() + b * G * S;
+            args.bias = decompressionBias.data() + b * S;
+            args.groups_num = G;
+            args.group_size = IC / G;
+        });
+#endif
+}
+
 }   // namespace node
 }   // namespace intel_cpu
 }   // namespace ov
@@ -14,6 +14,10 @@
 
 namespace ov {
 namespace intel_cpu {
+
+struct jit_sparse_fc_kernel;
+struct jit_weights_decompression_fc_kernel;
+
 namespace node {
 
 class FullyConnected : public Node {
@@ -57,6 +61,13 @@ public:
     void executeDynamicImpl(dnnl::stream strm) override;
     bool canBeExecutedInInt8() const override;
 
+    /**
+     * Fuses the dequantization of the u8/i8 weights, which are kept compressed and dequantized by the kernel.
+     * The scales and zero points are [OC, groups], the input channels are split to the groups of the equal size
+     */
+    void fuseWeightsDecompression(std::vector<float> scales, std::vector<float> zeroPoints, size_t groups);
+    static bool isWeightsDecompressionSupported();
+
 private:
     void createDescriptorInternal(const dnnl::memory::desc &inputDesc,
                                   const dnnl::memory::desc &outputDesc);
@@ -100,6 +111,40 @@ private:
     float weiSparseRate = 0.f;
     bool useSparseWeightsDecompression();
     VectorDims expectedBiasDims {};
+
+    // block sparse FP32 weights, executed by the own jit kernel instead of oneDNN
+    bool useBlockSparseWeights = false;
+    bool useBlockSparseWeightsKernel();
+    void packBlockSparseWeights();
+    void executeBlockSparse();
+    size_t sparseBlockSize = 0;
+    // non-zero (sparseBlockSize x 1) columns of the weights for every block of the output channels
+    std::vector<float> sparseValues;
+    // byte offsets of the input channels of the columns
+    std::vector<int64_t> sparseOffsets;
+    // index of the first column of every block, blocks number + 1 values
+    std::vector<size_t> sparseBlockStarts;
+    // bias padded to the whole number of the blocks
+    std::vector<float> sparseBias;
+    std::shared_ptr<jit_sparse_fc_kernel> sparseKernel;
+    std::shared_ptr<jit_sparse_fc_kernel> sparseKernelRow;
+
+    // weight-only compressed weights, executed by the own jit kernel instead of oneDNN
+    bool useWeightsDecompression = false;
+    void packDecompressedWeights();
+    void executeWeightsDecompression();
+    size_t decompressionGroups = 1;
+    size_t decompressionBlockSize = 0;
+    std::vector<float> decompressionScales;
+    std::vector<float> decompressionZeroPoints;
+    // weights repacked to [blocks, IC, block size], shared between the streams by the weights cache
+    MemoryPtr decompressionWeights;
+    // scales and zero points repacked to [blocks, groups, block size], bias padded to the whole number of the blocks
+    std::vector<float> decompressionPackedScales;
+    std::vector<float> decompressionPackedZeroPoints;
+    std::vector<float> decompressionBias;
+    std::shared_ptr<jit_weights_decompression_fc_kernel> decompressionKernel;
+    std::shared_ptr<jit_weights_decompression_fc_kernel> decompressionKernelRow;
 };
 
 }   // namespace node
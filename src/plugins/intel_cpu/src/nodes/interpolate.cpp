@@ -1555,6 +1555,9 @@ struct InterpolateKey {
     std::vector<float> dataScales;
     dnnl::primitive_attr attr;
 
+    // the executors keep the pillow working buffer, which is indexed by the thread number of the stream arena
+    static constexpr bool sharedCacheAllowed = false;
+
     size_t hash() const;
     bool operator==(const InterpolateKey& rhs) const;
 };
@@ -0,0 +1,76 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_fc_kernel.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+
+namespace ov {
+namespace intel_cpu {
+
+#define GET_OFF(field) offsetof(jit_sparse_fc_args, field)
+
+template <cpu_isa_t isa>
+void jit_sparse_fc_kernel_f32<isa>::generate() {
+    using Xbyak::Label;
+
+    this->preamble();
+
+    mov(reg_src, ptr[param1 + GET_OFF(src)]);
+    mov(reg_weights, ptr[param1 + GET_OFF(weights)]);
+    mov(reg_offsets, ptr[param1 + GET_OFF(offsets)]);
+    mov(reg_dst, ptr[param1 + GET_OFF(dst)]);
+    mov(reg_blocks_num, ptr[param1 + GET_OFF(blocks_num)]);
+    mov(reg_src_stride, ptr[param1 + GET_OFF(src_stride)]);
+    mov(reg_dst_stride, ptr[param1 + GET_OFF(dst_stride)]);
+
+    auto vmm_acc = [](size_t row) {
+        return Vmm(static_cast<int>(row));
+    };
+    const Vmm vmm_weights = Vmm(static_cast<int>(max_rows));
+    const Vmm vmm_src = Vmm(static_cast<int>(max_rows + 1));
+
+    mov(reg_tmp, ptr[param1 + GET_OFF(bias)]);
+    for (size_t row = 0; row < rows_; row++)
+        uni_vmovups(vmm_acc(row), ptr[reg_tmp]);
+
+    Label loop_label;
+    Label loop_end_label;
+    test(reg_blocks_num, reg_blocks_num);
+    jz(loop_end_label, T_NEAR);
+    L(loop_label);
+    {
+        // the weights column is loaded once and multiplied by the input channel of all the rows
+        uni_vmovups(vmm_weights, ptr[reg_weights]);
+        mov(reg_src_row, reg_src);
+        add(reg_src_row, ptr[reg_offsets]);
+        for (size_t row = 0; row < rows_; row++) {
+            uni_vbroadcastss(vmm_src, ptr[reg_src_row]);
+            uni_vfmadd231ps(vmm_acc(row), vmm_weights, vmm_src);
+            if (row + 1 < rows_)
+                add(reg_src_row, reg_src_stride);
+        }
+
+        add(reg_weights, vlen);
+        add(reg_offsets, sizeof(int64_t));
+        dec(reg_blocks_num);
+        jnz(loop_label, T_NEAR);
+    }
+    L(loop_end_label);
+
+    for (size_t row = 0; row < rows_; row++) {
+        uni_vmovups(ptr[reg_dst], vmm_acc(row));
+        if (row + 1 < rows_)
+            add(reg_dst, reg_dst_stride);
+    }
+
+    this->postamble();
+}
+
+template struct jit_sparse_fc_kernel_f32<cpu::x64::avx2>;
+template struct jit_sparse_fc_kernel_f32<cpu::x64::avx512_core>;
+
+}   // namespace intel_cpu
+}   // namespace ov
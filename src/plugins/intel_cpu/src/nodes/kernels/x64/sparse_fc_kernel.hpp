@@ -0,0 +1,81 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu/x64/jit_generator.hpp"
+#include <dnnl_types.h>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Arguments of the block sparse FullyConnected kernel, which computes a tile of the output rows for one block of the
+ * output channels. The weights of the block are packed as the non-zero (block_size x 1) columns only: every column is
+ * a vector of block_size weights of the output channels and is multiplied by one input channel.
+ */
+struct jit_sparse_fc_args {
+    const float* src;        // the first row of the tile
+    const float* weights;    // non-zero columns of the block, blocks_num x block_size
+    const int64_t* offsets;  // byte offsets of the input channels of the columns in a src row
+    const float* bias;       // block_size values
+    float* dst;              // the first row of the tile at the first output channel of the block
+    size_t blocks_num;
+    size_t src_stride;       // in bytes
+    size_t dst_stride;       // in bytes
+};
+
+struct jit_sparse_fc_kernel {
+    explicit jit_sparse_fc_kernel(size_t rows) : rows_(rows) {}
+    virtual ~jit_sparse_fc_kernel() {}
+
+    void (*ker_)(const jit_sparse_fc_args*) = nullptr;
+
+    void operator()(const jit_sparse_fc_args* args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    virtual void create_ker() = 0;
+
+    // number of the rows computed by one call
+    size_t rows_;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_sparse_fc_kernel_f32 : public jit_sparse_fc_kernel, public dnnl::impl::cpu::x64::jit_generator {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sparse_fc_kernel_f32)
+
+    explicit jit_sparse_fc_kernel_f32(size_t rows) : jit_sparse_fc_kernel(rows), jit_generator(jit_name()) {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override;
+
+    static constexpr size_t block_size = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen / sizeof(float);
+    // the accumulators of all the rows, the weights column and the broadcasted input must fit the vector registers
+    static constexpr size_t max_rows = 8;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    static constexpr int vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_weights = r9;
+    Xbyak::Reg64 reg_offsets = r10;
+    Xbyak::Reg64 reg_dst = r11;
+    Xbyak::Reg64 reg_blocks_num = r12;
+    Xbyak::Reg64 reg_src_stride = r13;
+    Xbyak::Reg64 reg_dst_stride = r14;
+    Xbyak::Reg64 reg_src_row = r15;
+    Xbyak::Reg64 reg_tmp = rax;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,116 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_decompression_fc_kernel.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+
+namespace ov {
+namespace intel_cpu {
+
+#define GET_OFF(field) offsetof(jit_weights_decompression_fc_args, field)
+
+template <cpu_isa_t isa>
+void jit_weights_decompression_fc_kernel_f32<isa>::generate() {
+    using Xbyak::Label;
+
+    this->preamble();
+
+    mov(reg_src, ptr[param1 + GET_OFF(src)]);
+    mov(reg_weights, ptr[param1 + GET_OFF(weights)]);
+    mov(reg_scales, ptr[param1 + GET_OFF(scales)]);
+    mov(reg_zero_points, ptr[param1 + GET_OFF(zero_points)]);
+    mov(reg_dst, ptr[param1 + GET_OFF(dst)]);
+    mov(reg_groups_num, ptr[param1 + GET_OFF(groups_num)]);
+    mov(reg_group_size, ptr[param1 + GET_OFF(group_size)]);
+    mov(reg_src_stride, ptr[param1 + GET_OFF(src_stride)]);
+    lea(reg_src_stride3, ptr[reg_src_stride + reg_src_stride * 2]);
+
+    auto vmm_acc = [](size_t row) {
+        return Vmm(static_cast<int>(row));
+    };
+    auto vmm_group_acc = [](size_t row) {
+        return Vmm(static_cast<int>(max_rows + row));
+    };
+    const Vmm vmm_weights = Vmm(static_cast<int>(2 * max_rows));
+    const Vmm vmm_zero_point = Vmm(static_cast<int>(2 * max_rows + 1));
+    const Vmm vmm_src = Vmm(static_cast<int>(2 * max_rows + 2));
+    const Vmm vmm_scale = Vmm(static_cast<int>(2 * max_rows + 3));
+
+    auto src_row_ptr = [&](size_t row) {
+        switch (row) {
+        case 0: return ptr[reg_src];
+        case 1: return ptr[reg_src + reg_src_stride];
+        case 2: return ptr[reg_src + reg_src_stride * 2];
+        default: return ptr[reg_src + reg_src_stride3];
+        }
+    };
+
+    mov(reg_tmp, ptr[param1 + GET_OFF(bias)]);
+    for (size_t row = 0; row < rows_; row++)
+        uni_vmovups(vmm_acc(row), ptr[reg_tmp]);
+
+    Label groups_loop_label;
+    Label groups_loop_end_label;
+    Label ic_loop_label;
+    Label ic_loop_end_label;
+    test(reg_groups_num, reg_groups_num);
+    jz(groups_loop_end_label, T_NEAR);
+    L(groups_loop_label);
+    {
+        // the products are accumulated per group, so the scale is applied once per group instead of every weight
+        for (size_t row = 0; row < rows_; row++)
+            uni_vpxor(vmm_group_acc(row), vmm_group_acc(row), vmm_group_acc(row));
+        uni_vmovups(vmm_zero_point, ptr[reg_zero_points]);
+
+        mov(reg_ic, reg_group_size);
+        test(reg_ic, reg_ic);
+        jz(ic_loop_end_label, T_NEAR);
+        L(ic_loop_label);
+        {
+            if (signed_weights_)
+                vpmovsxbd(vmm_weights, ptr[reg_weights]);
+            else
+                vpmovzxbd(vmm_weights, ptr[reg_weights]);
+            uni_vcvtdq2ps(vmm_weights, vmm_weights);
+            uni_vsubps(vmm_weights, vmm_weights, vmm_zero_point);
+            for (size_t row = 0; row < rows_; row++) {
+                uni_vbroadcastss(vmm_src, src_row_ptr(row));
+                uni_vfmadd231ps(vmm_group_acc(row), vmm_weights, vmm_src);
+            }
+
+            add(reg_weights, block_size);
+            add(reg_src, sizeof(float));
+            dec(reg_ic);
+            jnz(ic_loop_label, T_NEAR);
+        }
+        L(ic_loop_end_label);
+
+        uni_vmovups(vmm_scale, ptr[reg_scales]);
+        for (size_t row = 0; row < rows_; row++)
+            uni_vfmadd231ps(vmm_acc(row), vmm_group_acc(row), vmm_scale);
+
+        add(reg_scales, vlen);
+        add(reg_zero_points, vlen);
+        dec(reg_groups_num);
+        jnz(groups_loop_label, T_NEAR);
+    }
+    L(groups_loop_end_label);
+
+    mov(reg_tmp, ptr[param1 + GET_OFF(dst_stride)]);
+    for (size_t row = 0; row < rows_; row++) {
+        uni_vmovups(ptr[reg_dst], vmm_acc(row));
+        if (row + 1 < rows_)
+            add(reg_dst, reg_tmp);
+    }
+
+    this->postamble();
+}
+
+template struct jit_weights_decompression_fc_kernel_f32<cpu::x64::avx2>;
+template struct jit_weights_decompression_fc_kernel_f32<cpu::x64::avx512_core>;
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,89 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu/x64/jit_generator.hpp"
+#include <dnnl_types.h>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Arguments of the FullyConnected kernel with the compressed weights, which computes a tile of the output rows for
+ * one block of the output channels. The u8/i8 weights of the block are packed as [IC, block_size], the input channels
+ * are split to the groups with the own scales and zero points of every output channel:
+ *     dst[oc] = bias[oc] + sum_g scale[g][oc] * sum_{ic in g} src[ic] * (weights[ic][oc] - zero_point[g][oc])
+ */
+struct jit_weights_decompression_fc_args {
+    const float* src;          // the first row of the tile
+    const uint8_t* weights;    // IC x block_size
+    const float* scales;       // groups_num x block_size
+    const float* zero_points;  // groups_num x block_size
+    const float* bias;         // block_size values
+    float* dst;                // the first row of the tile at the first output channel of the block
+    size_t groups_num;
+    size_t group_size;
+    size_t src_stride;         // in bytes
+    size_t dst_stride;         // in bytes
+};
+
+struct jit_weights_decompression_fc_kernel {
+    jit_weights_decompression_fc_kernel(size_t rows, bool signed_weights) : rows_(rows), signed_weights_(signed_weights) {}
+    virtual ~jit_weights_decompression_fc_kernel() {}
+
+    void (*ker_)(const jit_weights_decompression_fc_args*) = nullptr;
+
+    void operator()(const jit_weights_decompression_fc_args* args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    virtual void create_ker() = 0;
+
+    // number of the rows computed by one call
+    size_t rows_;
+    bool signed_weights_;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_weights_decompression_fc_kernel_f32 : public jit_weights_decompression_fc_kernel,
+                                                 public dnnl::impl::cpu::x64::jit_generator {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_weights_decompression_fc_kernel_f32)
+
+    jit_weights_decompression_fc_kernel_f32(size_t rows, bool signed_weights)
+        : jit_weights_decompression_fc_kernel(rows, signed_weights), jit_generator(jit_name()) {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override;
+
+    static constexpr size_t block_size = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen / sizeof(float);
+    // the group and the total accumulators of all the rows and 4 auxiliary vectors must fit 16 vector registers
+    static constexpr size_t max_rows = 4;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    static constexpr int vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_weights = r9;
+    Xbyak::Reg64 reg_scales = r10;
+    Xbyak::Reg64 reg_zero_points = r11;
+    Xbyak::Reg64 reg_dst = r12;
+    Xbyak::Reg64 reg_groups_num = r13;
+    Xbyak::Reg64 reg_group_size = r14;
+    Xbyak::Reg64 reg_src_stride = r15;
+    Xbyak::Reg64 reg_src_stride3 = rbx;
+    Xbyak::Reg64 reg_ic = rdx;
+    Xbyak::Reg64 reg_tmp = rax;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -11,6 +11,7 @@
 #include "utils/general_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/ngraph_utils.hpp"
+#include "memory_state.h"
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -31,11 +32,6 @@ MemoryNode::MemoryNode(const std::shared_ptr<ngraph::Node>& op) {
 
 bool MemoryOutput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!one_of(op->get_type_info(),
                 ngraph::op::v3::Assign::get_type_info_static(),
                 ngraph::op::v6::Assign::get_type_info_static())) {
@@ -88,11 +84,6 @@ void MemoryOutput::execute(dnnl::stream strm)  {
 
 bool MemoryInput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!one_of(op->get_type_info(),
                 ngraph::op::v3::ReadValue::get_type_info_static(),
                 ngraph::op::v6::ReadValue::get_type_info_static())) {
@@ -119,11 +110,17 @@ MemoryInput::MemoryInput(const std::shared_ptr<ngraph::Node>& op, const GraphCon
 void MemoryInput::createPrimitive() {
     Input::createPrimitive();
 
-    dataStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
+    // a dynamic state starts from the lower bounds of its dims, e.g. an empty history
+    auto stateDesc = getChildEdgeAt(0)->getMemory().getDescPtr();
+    if (!stateDesc->isDefined())
+        stateDesc = stateDesc->cloneWithNewDims(stateDesc->getShape().getMinDims());
+    dataStore->Create(stateDesc);
 
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
         dataStore->FillZero();
+    // until the request buffers are bound the state is updated in place
+    currentStore = nextStore = dataStore;
 }
 
 /**
@@ -157,18 +154,29 @@ MemoryPtr MemoryInput::getStore() {
     return dataStore;
 }
 
+void MemoryInput::bindStates(MemoryPtr current, MemoryPtr next) {
+    currentStore = std::move(current);
+    nextStore = std::move(next);
+    stateStored = false;
+    if (isDynamicNode())
+        redefineOutputMemory({currentStore->getStaticDims()});
+}
+
 void MemoryInput::storeState(const Memory &new_state) {
     // TODO: Should be next one call:
     //           dataStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    if (nextStore->getStaticDims() != new_state.getStaticDims())
+        VariableState::redefineBuffer(*nextStore, new_state.getStaticDims());
+    simple_copy(*nextStore, new_state);
+    stateStored = true;
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    simple_copy(getChildEdgeAt(0)->getMemory(), *currentStore);
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
@@ -68,9 +68,14 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override {}
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
     bool created() const override {
         return getType() == Type::MemoryOutput;
     }
+    bool needShapeInfer() const override { return false; }
+    bool needPrepareParams() const override { return false; }
 
     void setInputNode(Node* node) override {
         inputNode = node;
@@ -97,14 +102,29 @@ public:
         return true;
     }
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
 
     void createPrimitive() override;
 
     void setInputNode(Node* node) override {}
     void storeState(const Memory& mem);
     MemoryPtr getStore();
+    /**
+     * @brief binds the state buffers of an infer request: the state is read from the current buffer and
+     * the new state is written to the next one, so the buffers are swapped by the request instead of being copied.
+     * The output of a dynamic node is redefined by the dims of the current state
+     */
+    void bindStates(MemoryPtr current, MemoryPtr next);
+    bool isStateStored() const {
+        return stateStored;
+    }
  private:
     MemoryPtr dataStore;
+    MemoryPtr currentStore;
+    MemoryPtr nextStore;
+    bool stateStored = false;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -23,6 +23,7 @@
 #include <snippets/op/subgraph.hpp>
 #include "snippets/pass/matmul_to_brgemm.hpp"
 #include "utils/cpu_utils.hpp"
+#include <common/primitive_hashing_utils.hpp>
 #include "emitters/x64/cpu_generator.hpp"
 #include "transformations/snippets/x64/pass/lowered/fuse_load_store_and_convert.hpp"
 #include "transformations/snippets/x64/pass/lowered/brgemm_blocking.hpp"
@@ -63,6 +64,50 @@ private:
     Snippet* m_node;
 };
 
+struct SnippetKey {
+    // the original subgraph is shared by the graphs of all the streams
+    std::shared_ptr<const snippets::op::Subgraph> subgraph;
+    std::vector<VectorDims> inputShapes;
+    std::vector<VectorDims> outputShapes;
+    std::vector<VectorDims> orders;
+    std::vector<Precision> precisions;
+    VectorDims masterShape;
+    size_t tileRank;
+    cpu_isa_t isa;
+    ov::element::Type inferencePrecision;
+
+    size_t hash() const {
+        using namespace dnnl::impl::primitive_hashing;
+        size_t seed = 0;
+        seed = hash_combine(seed, subgraph.get());
+        for (const auto& shape : inputShapes)
+            seed = get_vector_hash(seed, shape);
+        for (const auto& shape : outputShapes)
+            seed = get_vector_hash(seed, shape);
+        for (const auto& order : orders)
+            seed = get_vector_hash(seed, order);
+        for (const auto& precision : precisions)
+            seed = hash_combine(seed, precision.getPrecVal());
+        seed = get_vector_hash(seed, masterShape);
+        seed = hash_combine(seed, tileRank);
+        seed = hash_combine(seed, isa);
+        seed = hash_combine(seed, inferencePrecision.hash());
+        return seed;
+    }
+
+    bool operator==(const SnippetKey& rhs) const {
+        return subgraph == rhs.subgraph &&
+               inputShapes == rhs.inputShapes &&
+               outputShapes == rhs.outputShapes &&
+               orders == rhs.orders &&
+               precisions == rhs.precisions &&
+               masterShape == rhs.masterShape &&
+               tileRank == rhs.tileRank &&
+               isa == rhs.isa &&
+               inferencePrecision == rhs.inferencePrecision;
+    }
+};
+
 class SnippetShapeInferFactory : public ShapeInferFactory {
 public:
     SnippetShapeInferFactory(Snippet* node) : m_node(node) {}
@@ -382,8 +427,28 @@ void Snippet::createPrimitive() {
     prepareParams();
     jcp.master_shape = masterShape;
     jcp.tile_rank = tileRank;
-    generate(&jcp);
-    buffer_scratchpad_size = snippet->get_buffer_scratchpad_size();
+
+    // the same subgraph is compiled by the graph of each stream, so the code is generated once for the compiled model
+    SnippetKey key = {original_snippet, normInputShapes, normOutputShapes, {}, {}, masterShape, tileRank, host_isa,
+                      context->getConfig().inferencePrecision};
+    for (size_t i = 0; i < inputShapes.size(); i++) {
+        const auto desc = getParentEdgeAt(i)->getMemory().GetDescWithType<BlockedMemoryDesc>();
+        key.orders.push_back(desc->getOrder());
+        key.precisions.push_back(desc->getPrecision());
+    }
+    for (size_t i = 0; i < outputShapes.size(); i++) {
+        const auto desc = getChildEdgeAt(i)->getMemory().GetDescWithType<BlockedMemoryDesc>();
+        key.orders.push_back(desc->getOrder());
+        key.precisions.push_back(desc->getPrecision());
+    }
+    auto builder = [this, &jcp](const SnippetKey&) -> std::shared_ptr<GeneratedKernel> {
+        generate(&jcp);
+        return std::make_shared<GeneratedKernel>(
+            GeneratedKernel{snippet, schedule, snippet->get_buffer_scratchpad_size()});
+    };
+    generatedKernel = context->getSnippetsCache()->getOrCreate(key, builder).first;
+    schedule = generatedKernel->schedule;
+    buffer_scratchpad_size = generatedKernel->bufferScratchpadSize;
     buffer_scratchpad.resize(buffer_scratchpad_size * parallel_get_max_threads(), 0);
 }
 
@@ -76,6 +76,15 @@ private:
     // Holds generated snippet with information about how to schedule it
     snippets::Schedule schedule;
 
+    // Generated code shared between the nodes of all the streams via the snippets cache
+    struct GeneratedKernel {
+        // the generator of the subgraph owns the code
+        std::shared_ptr<snippets::op::Subgraph> snippet;
+        snippets::Schedule schedule;
+        size_t bufferScratchpadSize;
+    };
+    std::shared_ptr<GeneratedKernel> generatedKernel;
+
     // Holds ISA version used is codeGeneration target
     dnnl::impl::cpu::x64::cpu_isa_t host_isa;
     size_t isa_num_lanes = 0; // number of elements that fit in vector size
@@ -11,10 +11,26 @@
 
 #include "itt.hpp"
 
+namespace {
+// The compressed weights are kept as the decompression subgraph over the Constant (see MarkWeightsDecompression)
+bool is_on_constant_path(const ngraph::Output<ngraph::Node>& output) {
+    const auto node = output.get_node();
+    if (ngraph::is_type<ngraph::opset1::Constant>(node))
+        return true;
+    if (!ngraph::is_type<ngraph::opset1::Convert>(node) && !ngraph::is_type<ngraph::opset1::Subtract>(node) &&
+        !ngraph::is_type<ngraph::opset1::Multiply>(node) && !ngraph::is_type<ngraph::opset1::Reshape>(node))
+        return false;
+    const auto& inputs = node->input_values();
+    return std::all_of(inputs.begin(), inputs.end(), is_on_constant_path);
+}
+}   // namespace
+
 ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
     MATCHER_SCOPE(ConvertMatMulToFC);
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
-    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto weights_m = ngraph::pattern::any_input([](const ngraph::Output<ngraph::Node>& output) {
+        return ngraph::pattern::has_static_shape()(output) && is_on_constant_path(output);
+    });
     auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
@@ -45,7 +61,7 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
 
         // Check that if second inputs is Constant path and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
-        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
+        if (!is_on_constant_path(fc_input_b) ||
             std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
             return false;
         }
@@ -0,0 +1,84 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_weights_decompression.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/dequantization_node.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+#include "itt.hpp"
+
+NGRAPH_RTTI_DEFINITION(ov::intel_cpu::MarkWeightsDecompression, "MarkWeightsDecompression");
+
+ov::intel_cpu::MarkWeightsDecompression::MarkWeightsDecompression() {
+    MATCHER_SCOPE(MarkWeightsDecompression);
+    using namespace ngraph::pattern;
+    // the conditions mirror the FuseFCAndWeightsDecompression graph optimization: the subgraph which is not fused
+    // must stay foldable, otherwise both the compressed and the decompressed weights are kept by the plugin
+    auto weights_m = wrap_type<ngraph::opset1::Constant>(type_matches_any({ngraph::element::u8, ngraph::element::i8}));
+    auto convert_m = wrap_type<ngraph::opset1::Convert>({weights_m},
+                                                        [](const ngraph::Output<ngraph::Node>& output) {
+                                                            return consumers_count(1)(output) &&
+                                                                   type_matches(ngraph::element::f32)(output);
+                                                        });
+    // the zero point may still be converted from the low precision constant, it is folded anyway
+    auto subtract_m = wrap_type<ngraph::opset1::Subtract>({convert_m, any_input()}, consumers_count(1));
+    auto scaled_input_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{subtract_m, convert_m});
+    auto multiply_m = wrap_type<ngraph::opset1::Multiply>({scaled_input_m, any_input()}, consumers_count(1));
+    // the grouped scales are applied to [OC, groups, group size] weights, which are reshaped to [OC, IC]
+    auto reshape_m = wrap_type<ngraph::opset1::Reshape>({multiply_m, wrap_type<ngraph::opset1::Constant>()},
+                                                        consumers_count(1));
+    auto matmul_weights_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{reshape_m, multiply_m});
+    auto matmul_m = wrap_type<ngraph::opset1::MatMul>({any_input(type_matches(ngraph::element::f32)),
+                                                       matmul_weights_m},
+                                                      type_matches(ngraph::element::f32));
+
+    ngraph::matcher_pass_callback callback = [=](Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        // the weights which are not [OC, IC] are transposed by the FullyConnected conversion
+        const auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(m.get_match_root());
+        if (!matmul || !matmul->get_transpose_b())
+            return false;
+
+        // the weights are either [OC, IC] or grouped [OC, groups, group size] and reshaped to [OC, IC]
+        const auto& fc_weights_shape = matmul->get_input_partial_shape(1);
+        const auto& weights_shape = pattern_map.at(convert_m).get_partial_shape();
+        if (fc_weights_shape.is_dynamic() || fc_weights_shape.size() != 2 || weights_shape.is_dynamic())
+            return false;
+        const bool with_reshape = pattern_map.count(reshape_m) != 0;
+        if (!(weights_shape.size() == 2 || (weights_shape.size() == 3 && with_reshape)) ||
+            weights_shape[0] != fc_weights_shape[0] ||
+            ngraph::shape_size(weights_shape.to_shape()) != ngraph::shape_size(fc_weights_shape.to_shape()))
+            return false;
+
+        // the scale and the zero point are per output channel (and group)
+        auto is_decompression_constant = [&](const ngraph::Output<ngraph::Node>& output) {
+            const auto node = output.get_node_shared_ptr();
+            if (!ov::is_type<ngraph::opset1::Constant>(node) && !ov::is_type<ngraph::opset1::Convert>(node))
+                return false;
+            const auto& shape = output.get_partial_shape();
+            return output.get_element_type() == ngraph::element::f32 && shape.is_static() &&
+                   shape.size() <= weights_shape.size() && (shape.size() == 0 || shape[shape.size() - 1] == 1);
+        };
+        const auto multiply = pattern_map.at(multiply_m).get_node_shared_ptr();
+        if (!is_decompression_constant(multiply->input_value(1)))
+            return false;
+        const auto subtract = pattern_map.find(subtract_m);
+        if (subtract != pattern_map.end() &&
+            !is_decompression_constant(subtract->second.get_node_shared_ptr()->input_value(1)))
+            return false;
+
+        ov::disable_constant_folding(pattern_map.at(convert_m).get_node_shared_ptr());
+        if (subtract != pattern_map.end())
+            ov::mark_as_dequantization_node(subtract->second.get_node_shared_ptr());
+        ov::mark_as_dequantization_node(multiply);
+        return false;
+    };
+
+    auto m = std::make_shared<Matcher>(matmul_m, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,30 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Keeps the weight-only compressed MatMul weights in the low precision:
+ *
+ *   Constant [u8/i8] -> Convert [f32] -> (Subtract zero point) -> Multiply scale -> (Reshape) -> MatMul (weights)
+ *
+ * The Convert is excluded from the constant folding and the Subtract/Multiply are marked as the dequantization nodes,
+ * so the subgraph survives up to the FullyConnected node, which dequantizes the weights on the fly.
+ * Only the subgraphs FuseFCAndWeightsDecompression is able to fuse are marked: f32 MatMul with transpose_b,
+ * static [OC, IC] (or grouped and reshaped) weights and per channel decompression constants.
+ * The pass is expected to be applied only with the f32 inference precision.
+ */
+class MarkWeightsDecompression : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MarkWeightsDecompression();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
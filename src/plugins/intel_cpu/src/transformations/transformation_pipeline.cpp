@@ -107,6 +107,7 @@
 #include "transformations/cpu_opset/common/pass/move_eltwise_up_data_movement.hpp"
 #include "transformations/cpu_opset/common/pass/ref_convert_i64_i32.hpp"
 #include "transformations/cpu_opset/common/pass/swap_convert_transpose.hpp"
+#include "transformations/cpu_opset/common/pass/mark_weights_decompression.hpp"
 
 // Snippets
 #include "snippets/pass/tokenization.hpp"
@@ -122,6 +123,8 @@
 #include "dnnl.hpp"
 #include <cpu/x64/cpu_isa_traits.hpp>
 
+#include <functional>
+
 namespace ov {
 namespace intel_cpu {
 
@@ -207,6 +210,10 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     const bool useLpt = !defaultPrecisions.empty();
     if (useLpt) {
         CPU_REGISTER_PASS_COMMON(manager, ov::pass::MarkDequantizationSubgraph, defaultPrecisions);
+    } else if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2) && inferencePrecision == ov::element::f32) {
+        // weight-only compressed MatMuls are executed by FullyConnected with the weights decompression
+        // (f32 only: with the lower inference precision the FullyConnected is not fused with the decompression)
+        CPU_REGISTER_PASS_X64(manager, MarkWeightsDecompression);
     }
 
     auto get_convert_precisions = []() {
@@ -713,11 +720,25 @@ void Transformations::MainSnippets(void) {
                                                        ov::is_type<const ov::op::v1::Broadcast>(n) ||
                                                        ov::is_type<const ov::op::v3::Broadcast>(n));
                 const auto& inputs = n->inputs();
+                // the weights decompression subgraphs are not folded (see MarkWeightsDecompression), but are still
+                // constant paths, which are executed by the plugin nodes once at the compilation stage
+                std::function<bool(const ov::Node*)> is_on_const_path = [&](const ov::Node* node) {
+                    if (ov::is_type<ov::op::v0::Constant>(node))
+                        return true;
+                    if (!ov::is_type<ov::op::v0::Convert>(node) && !ov::is_type<ov::op::v1::Subtract>(node) &&
+                        !ov::is_type<ov::op::v1::Multiply>(node) && !ov::is_type<ov::op::v1::Reshape>(node))
+                        return false;
+                    for (const auto& input : node->inputs()) {
+                        if (!is_on_const_path(input.get_source_output().get_node()))
+                            return false;
+                    }
+                    return true;
+                };
                 // todo: clarify whether we can evaluate snippets on const paths
                 const bool has_only_const_inputs = std::all_of(inputs.begin(), inputs.end(),
-                                                               [](const ov::Input<const ov::Node>& in) {
-                                                                   return ov::is_type<ov::op::v0::Constant>(
-                                                                           in.get_source_output().get_node_shared_ptr());
+                                                               [&](const ov::Input<const ov::Node>& in) {
+                                                                   return is_on_const_path(
+                                                                           in.get_source_output().get_node());
                                                                });
                 // todo: clarify whether we can evaluate snippets on inputs with larger ranks
                 auto rank_is_too_large = [](const ov::descriptor::Tensor& t) {
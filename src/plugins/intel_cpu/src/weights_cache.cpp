@@ -5,13 +5,94 @@
 #include "weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <memory>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace ov {
 namespace intel_cpu {
 
+SimpleDataHash::SimpleDataHash() {
+    for (int i = 0; i < kTableSize; i++) {
+        uint64_t c = i;
+        for (int j = 0; j < 8; j++)
+            c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
+        table[0][i] = c;
+    }
+    for (int i = 0; i < kTableSize; i++) {
+        for (int slice = 1; slice < kSlicesNum; slice++)
+            table[slice][i] = table[0][table[slice - 1][i] & 0xff] ^ (table[slice - 1][i] >> 8);
+    }
+}
+
+uint64_t SimpleDataHash::update(uint64_t crc, const unsigned char* data, size_t size) const {
+    size_t idx = 0;
+    // the tables are built for the little endian load order, which holds for all the supported platforms
+    for (; idx + sizeof(uint64_t) <= size; idx += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + idx, sizeof(word));
+        crc ^= word;
+        crc = table[7][crc & 0xff] ^ table[6][(crc >> 8) & 0xff] ^
+              table[5][(crc >> 16) & 0xff] ^ table[4][(crc >> 24) & 0xff] ^
+              table[3][(crc >> 32) & 0xff] ^ table[2][(crc >> 40) & 0xff] ^
+              table[1][(crc >> 48) & 0xff] ^ table[0][crc >> 56];
+    }
+    for (; idx < size; idx++)
+        crc = table[0][(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
+
+    return crc;
+}
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    if (size <= kChunkSize)
+        return ~update(0, data, size);
+
+    const size_t chunksNum = (size + kChunkSize - 1) / kChunkSize;
+    std::vector<uint64_t> chunksCrc(chunksNum);
+    InferenceEngine::parallel_for(chunksNum, [&](size_t i) {
+        const size_t offset = i * kChunkSize;
+        chunksCrc[i] = update(0, data + offset, std::min(size - offset, static_cast<size_t>(kChunkSize)));
+    });
+
+    return ~update(0, reinterpret_cast<const unsigned char*>(chunksCrc.data()), chunksNum * sizeof(uint64_t));
+}
+
 const SimpleDataHash WeightsSharing::simpleCRC;
 
+namespace {
+#if defined(__linux__)
+void bindToNumaNode(void* data, size_t size, int numaNodeId) {
+    // mbind is called directly to not depend on libnuma
+    constexpr int mpolPreferred = 1;
+    constexpr unsigned mpolMfMove = 1 << 1;
+    unsigned long nodeMask = 0;
+    if (data == nullptr || size == 0 || numaNodeId >= static_cast<int>(sizeof(nodeMask) * 8))
+        return;
+    nodeMask = 1ul << numaNodeId;
+
+    // the policy is set for the whole pages, the neighbour allocations sharing the edge pages belong to the same
+    // cache in most cases
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = reinterpret_cast<uintptr_t>(data) / pageSize * pageSize;
+    const auto end = reinterpret_cast<uintptr_t>(data) + size;
+    // the placement is an optimization only, so a failure (e.g. the lack of memory on the node) is ignored
+    syscall(SYS_mbind, begin, end - begin, mpolPreferred, &nodeMask, sizeof(nodeMask) * 8 + 1, mpolMfMove);
+}
+#else
+void bindToNumaNode(void*, size_t, int) {}
+#endif
+}   // namespace
+
+WeightsSharing::WeightsSharing(int numaNodeId) : numaNodeId(numaNodeId) {}
+
 WeightsSharing::SharedMemory::SharedMemory(
         std::unique_lock<std::mutex> && lock,
         const MemoryInfo::Ptr & memory,
@@ -46,6 +127,8 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
         if (found == sharedWeights.end()
             || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
             newPtr = create();
+            if (numaNodeId >= 0)
+                bindToNumaNode(newPtr->GetData(), newPtr->GetSize(), numaNodeId);
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
         }
@@ -55,6 +138,16 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+size_t WeightsSharing::getTotalSize() const {
+    std::unique_lock<std::mutex> lock(guard);
+    size_t size = 0;
+    for (const auto& weights : sharedWeights) {
+        if (auto memory = weights.second->sharedMemory.lock())
+            size += memory->GetSize();
+    }
+    return size;
+}
+
 WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) const {
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
@@ -71,9 +164,12 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
-NumaNodesWeights::NumaNodesWeights() {
-    for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<WeightsSharing>();
+NumaNodesWeights::NumaNodesWeights(bool bindToNodes) {
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    // there is nothing to bind on a single node system
+    bindToNodes = bindToNodes && numaNodes.size() > 1;
+    for (auto numa_id : numaNodes)
+        _cache_map[numa_id] = std::make_shared<WeightsSharing>(bindToNodes ? numa_id : -1);
 }
 
 WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
@@ -90,5 +186,12 @@ const WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const {
     return found->second;
 }
 
+std::map<int, size_t> NumaNodesWeights::getTotalSizes() const {
+    std::map<int, size_t> sizes;
+    for (const auto& cache : _cache_map)
+        sizes[cache.first] = cache.second->getTotalSize();
+    return sizes;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -25,26 +25,23 @@ namespace intel_cpu {
 
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
+    SimpleDataHash();
+
+    /**
+     * Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182.
+     * Large buffers are split into fixed size chunks which are hashed in parallel, then the chunk sums are hashed
+     * together, so the result doesn't depend on the number of threads.
+     */
+    uint64_t hash(const unsigned char* data, size_t size) const;
 
 protected:
+    // CRC64 update processing 8 bytes per iteration ("slicing-by-8")
+    uint64_t update(uint64_t crc, const unsigned char* data, size_t size) const;
+
     static constexpr int kTableSize = 256;
-    uint64_t table[kTableSize];
+    static constexpr int kSlicesNum = 8;
+    static constexpr size_t kChunkSize = 1 << 20;
+    uint64_t table[kSlicesNum][kTableSize];
 };
 
 /**
@@ -70,6 +67,11 @@ class WeightsSharing {
 public:
     typedef std::shared_ptr<WeightsSharing> Ptr;
 
+    /**
+     * @param numaNodeId the node to bind the created memory to, -1 leaves the placement to the OS
+     */
+    explicit WeightsSharing(int numaNodeId = -1);
+
     class SharedMemory {
     public:
         typedef std::shared_ptr<SharedMemory> Ptr;
@@ -94,9 +96,15 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * Returns the total size of the alive cached memory objects
+     */
+    size_t getTotalSize() const;
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
+    const int numaNodeId;
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
     static const SimpleDataHash simpleCRC;
@@ -109,11 +117,19 @@ protected:
  */
 class NumaNodesWeights {
 public:
-    NumaNodesWeights();
+    /**
+     * @param bindToNodes bind the memory of each cache to its NUMA node
+     */
+    explicit NumaNodesWeights(bool bindToNodes = false);
 
     WeightsSharing::Ptr& operator[](int i);
     const WeightsSharing::Ptr& operator[](int i) const;
 
+    /**
+     * Returns the total size of the cached memory per NUMA node id
+     */
+    std::map<int, size_t> getTotalSizes() const;
+
 private:
     std::map<int, WeightsSharing::Ptr> _cache_map;
 };
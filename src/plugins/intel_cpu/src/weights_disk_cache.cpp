@@ -0,0 +1,207 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_disk_cache.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <common/memory_desc_wrapper.hpp>
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include "memory_desc/cpu_memory_desc_utils.h"
+#include "openvino/core/version.hpp"
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+#include "weights_cache.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+// the version must be bumped on any change of the file layout
+constexpr char recordMagic[8] = {'C', 'P', 'U', 'W', 'E', 'I', '0', '2'};
+constexpr uint64_t dataAlignment = 64;
+
+struct RecordHeader {
+    char magic[sizeof(recordMagic)];
+    uint64_t keySize;
+    uint64_t dataOffset;
+    uint64_t dataSize;
+};
+
+/**
+ * The repacked layout and the values (e.g. the scale adjustment of the int8 weights on the hosts without VNNI)
+ * depend on the OpenVINO and oneDNN builds and on the ISA, so the records are bound to them
+ */
+const std::string& getBuildIdentity() {
+    static const std::string identity = [] {
+        const auto dnnlVersion = dnnl::version();
+        std::stringstream result;
+        result << "ov:" << ov::get_openvino_version().buildNumber
+               << "_dnnl:" << dnnlVersion->major << "." << dnnlVersion->minor << "." << dnnlVersion->patch
+               << "." << dnnlVersion->hash
+               << "_isa:" << static_cast<unsigned>(dnnl::get_effective_cpu_isa());
+        return result.str();
+    }();
+    return identity;
+}
+
+uint64_t getDataOffset(size_t keySize) {
+    const uint64_t size = sizeof(RecordHeader) + keySize;
+    return (size + dataAlignment - 1) / dataAlignment * dataAlignment;
+}
+
+/**
+ * Memory manager over the read-only mapped file, keeps the mapping alive as long as the memory is used
+ */
+class MappedMemoryMngr : public IMemoryMngr {
+public:
+    MappedMemoryMngr(std::shared_ptr<ov::MappedMemory> mapping, size_t offset, size_t size)
+        : _mapping(std::move(mapping)), _data(_mapping->data() + offset), _size(size) {}
+
+    void* getRawPtr() const noexcept override {
+        return _data;
+    }
+
+    void setExtBuff(void* ptr, size_t size) override {
+        if (ptr != _data || size > _size)
+            IE_THROW() << "Mapped weights memory can't be replaced";
+    }
+
+    bool resize(size_t size) override {
+        if (size > _size)
+            IE_THROW() << "Mapped weights memory can't be resized";
+        return false;
+    }
+
+    bool hasExtBuffer() const noexcept override {
+        return true;
+    }
+
+private:
+    std::shared_ptr<ov::MappedMemory> _mapping;
+    void* _data;
+    size_t _size;
+};
+
+}   // namespace
+
+WeightsDiskCache::WeightsDiskCache(std::string dir) : dir(std::move(dir)) {}
+
+std::string WeightsDiskCache::describe(const DnnlMemoryDescPtr& desc) {
+    if (!desc->isDefined() || dnnl::memory::format_kind::blocked != desc->getDnnlDesc().get_format_kind())
+        return {};
+
+    const auto blockedDesc = MemoryDescUtils::convertToBlockedMemoryDesc(desc);
+    // the extra part tells how the data was transformed by the reorder (compensation, scale adjustment)
+    const auto extra = dnnl::impl::memory_desc_wrapper(desc->getDnnlDesc().get()).extra();
+    std::stringstream result;
+    result << desc->getPrecision().name()
+           << "_" << MemoryDescUtils::dims2str(desc->getShape().getStaticDims())
+           << "_" << desc->serializeFormat()
+           << "_" << MemoryDescUtils::dims2str(blockedDesc->getStrides())
+           << "_" << desc->getOffsetPadding()
+           << "_" << desc->getCurrentMemSize()
+           << "_" << extra.flags << "_" << extra.compensation_mask << "_" << extra.scale_adjust;
+    return result.str();
+}
+
+MemoryPtr WeightsDiskCache::findOrCreate(const std::string& weightsKey,
+                                         const DnnlMemoryDescPtr& desc,
+                                         const dnnl::engine& eng,
+                                         const std::function<MemoryPtr(void)>& create) const {
+    // the build identity is a part of the stored key and of the file name, so the processes of the different builds
+    // or hosts sharing the directory neither use nor overwrite the records of each other
+    const auto key = getBuildIdentity() + "|" + weightsKey;
+    const auto keyHash = WeightsSharing::GetHashFunc().hash(reinterpret_cast<const unsigned char*>(key.data()),
+                                                            key.size());
+    std::stringstream fileName;
+    fileName << std::hex << keyHash << ".cpuw";
+    const auto path = ov::util::path_join({dir, fileName.str()});
+
+    if (auto ptr = load(path, key, desc, eng))
+        return ptr;
+
+    auto ptr = create();
+    store(path, key, *ptr);
+    return ptr;
+}
+
+MemoryPtr WeightsDiskCache::load(const std::string& path,
+                                 const std::string& key,
+                                 const DnnlMemoryDescPtr& desc,
+                                 const dnnl::engine& eng) const {
+    if (!ov::util::file_exists(path))
+        return nullptr;
+
+    std::shared_ptr<ov::MappedMemory> mapping;
+    try {
+        mapping = ov::load_mmap_object(path);
+    } catch (const std::exception&) {
+        return nullptr;
+    }
+
+    // the record may belong to another key with the same hash or be written by an incompatible version
+    RecordHeader header;
+    if (mapping->size() < sizeof(header))
+        return nullptr;
+    std::memcpy(&header, mapping->data(), sizeof(header));
+    const uint64_t dataSize = desc->getCurrentMemSize();
+    if (std::memcmp(header.magic, recordMagic, sizeof(recordMagic)) != 0 ||
+        header.keySize != key.size() ||
+        header.dataOffset != getDataOffset(key.size()) ||
+        header.dataSize != dataSize ||
+        mapping->size() < header.dataOffset + header.dataSize ||
+        key.compare(0, key.size(), mapping->data() + sizeof(header), header.keySize) != 0)
+        return nullptr;
+
+    auto ptr = std::make_shared<Memory>(
+        eng, std::unique_ptr<IMemoryMngr>(new MappedMemoryMngr(mapping, header.dataOffset, header.dataSize)));
+    // the pads were zeroed before the weights were stored, the mapping is read-only
+    ptr->Create(desc, mapping->data() + header.dataOffset, false);
+    return ptr;
+}
+
+void WeightsDiskCache::store(const std::string& path, const std::string& key, const Memory& memory) const {
+    const auto dataSize = memory.GetSize();
+    const auto* data = static_cast<const char*>(memory.GetData());
+    if (data == nullptr)
+        return;
+
+    RecordHeader header;
+    std::memcpy(header.magic, recordMagic, sizeof(recordMagic));
+    header.keySize = key.size();
+    header.dataOffset = getDataOffset(key.size());
+    header.dataSize = dataSize;
+
+    // the record is written under an unique name and renamed, so the concurrent readers never see a partial file
+    std::random_device rd;
+    const auto tmpPath = path + "." + std::to_string(rd()) + ".tmp";
+    try {
+        ov::util::create_directory_recursive(dir);
+
+        std::ofstream stream(tmpPath, std::ios::binary);
+        if (!stream.is_open())
+            return;
+        const std::vector<char> padding(header.dataOffset - sizeof(header) - key.size(), 0);
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        stream.write(key.data(), key.size());
+        stream.write(padding.data(), padding.size());
+        stream.write(data, dataSize);
+        stream.close();
+        if (!stream || std::rename(tmpPath.c_str(), path.c_str()) != 0)
+            std::remove(tmpPath.c_str());
+    } catch (const std::exception&) {
+        std::remove(tmpPath.c_str());
+    }
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+#include "memory_desc/dnnl_memory_desc.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Persistent store of the repacked (reordered) weights shared between the processes.
+ *
+ * Each record is a file named by the key hash, which holds the key itself and the weights in the layout of the
+ * requested descriptor. The key is prefixed with the OpenVINO build number, the oneDNN version and the CPU ISA. On lookup the file is memory mapped and used as the weights storage directly, so the reorder
+ * is skipped and the pages are shared with the page cache instead of being copied into the process heap.
+ * Any IO failure is treated as a cache miss, the cache never breaks the compilation.
+ *
+ * Is a thread and process safe
+ */
+class WeightsDiskCache {
+public:
+    typedef std::shared_ptr<WeightsDiskCache> Ptr;
+
+    explicit WeightsDiskCache(std::string dir);
+
+    /**
+     * Returns the weights stored for the key or creates them and puts them to the disk
+     * @param key identifies the weights content and layout, must be stable across processes
+     * @param desc descriptor of the weights memory
+     * @param create builds the weights on a cache miss
+     */
+    MemoryPtr findOrCreate(const std::string& key,
+                           const DnnlMemoryDescPtr& desc,
+                           const dnnl::engine& eng,
+                           const std::function<MemoryPtr(void)>& create) const;
+
+    /**
+     * Builds the part of a key describing the weights layout, the blocked descriptors only are supported
+     * @return an empty string if the descriptor can't be cached
+     */
+    static std::string describe(const DnnlMemoryDescPtr& desc);
+
+private:
+    MemoryPtr load(const std::string& path, const std::string& key, const DnnlMemoryDescPtr& desc,
+                   const dnnl::engine& eng) const;
+    void store(const std::string& path, const std::string& key, const Memory& memory) const;
+
+    std::string dir;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "memory_desc/dnnl_blocked_memory_desc.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Pool of the memory arenas for the intermediate tensors of the graphs of one compiled model.
+ *
+ * A graph holds an arena only while it is being initialized or executed, so the number of the arenas is bounded by the
+ * number of the concurrently executing graphs (streams) instead of the total number of graphs.
+ *
+ * Is a thread safe
+ */
+class WorkspacePool {
+public:
+    typedef std::shared_ptr<WorkspacePool> Ptr;
+
+    /**
+     * Returns a free arena of at least the requested size or allocates a new one
+     */
+    MemoryPtr acquire(size_t size, const dnnl::engine& eng) {
+        {
+            std::lock_guard<std::mutex> lock(guard);
+            // the smallest fitting arena is taken to leave the bigger ones to the graphs which need them
+            auto found = freeArenas.end();
+            for (auto it = freeArenas.begin(); it != freeArenas.end(); ++it) {
+                if ((*it)->GetSize() >= size && (found == freeArenas.end() || (*it)->GetSize() < (*found)->GetSize()))
+                    found = it;
+            }
+            if (found != freeArenas.end()) {
+                auto arena = *found;
+                freeArenas.erase(found);
+                return arena;
+            }
+        }
+
+        auto arena = std::make_shared<Memory>(eng);
+        arena->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{size})));
+        std::lock_guard<std::mutex> lock(guard);
+        totalSize += arena->GetSize();
+        return arena;
+    }
+
+    void release(MemoryPtr arena) {
+        std::lock_guard<std::mutex> lock(guard);
+        freeArenas.push_back(std::move(arena));
+    }
+
+    /**
+     * Returns the total size of the arenas allocated by the pool
+     */
+    size_t getTotalSize() const {
+        std::lock_guard<std::mutex> lock(guard);
+        return totalSize;
+    }
+
+private:
+    mutable std::mutex guard;
+    std::vector<MemoryPtr> freeArenas;
+    size_t totalSize = 0;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
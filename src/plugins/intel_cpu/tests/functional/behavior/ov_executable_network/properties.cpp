@@ -8,10 +8,13 @@
 #include <common_test_utils/test_assertions.hpp>
 #include "ie_system_conf.h"
 #include "ngraph_functions/subgraph_builders.hpp"
+#include "openvino/opsets/opset1.hpp"
+#include "openvino/op/interpolate.hpp"
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "internal_properties.hpp"
 #include "functional_test_utils/skip_tests_config.hpp"
 
 namespace {
@@ -40,6 +43,9 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::execution_devices.name()),
         RO_property(ov::intel_cpu::denormals_optimization.name()),
         RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RO_property(ov::intel_cpu::runtime_cache_statistics.name()),
+        RO_property(ov::intel_cpu::weights_memory_statistics.name()),
+        RO_property(ov::intel_cpu::snippets_cache_statistics.name()),
     };
 
     ov::Core ie;
@@ -144,6 +150,148 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSparseWeigthsDecompression
     ASSERT_NO_THROW(ov::CompiledModel compiledModel = core.compile_model(model, deviceName));
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSharedRuntimeCacheStatistics) {
+    ov::Core ie;
+    ov::AnyMap config;
+    config[ov::intel_cpu::shared_runtime_cache.name()] = true;
+    config[ov::num_streams.name()] = 2;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName, config);
+    std::map<std::string, uint64_t> statistics;
+    ASSERT_NO_THROW(statistics = compiledModel.get_property(ov::intel_cpu::runtime_cache_statistics));
+    ASSERT_EQ(statistics.size(), 3);
+    ASSERT_EQ(statistics.count("hits"), 1);
+    ASSERT_EQ(statistics.count("misses"), 1);
+    ASSERT_EQ(statistics.count("evictions"), 1);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSnippetsCacheStatistics) {
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        GTEST_SKIP();
+    // the eltwise chain is fused to a snippet
+    auto param = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 16, 8, 8});
+    auto sigmoid = std::make_shared<ov::opset1::Sigmoid>(param);
+    auto add = std::make_shared<ov::opset1::Add>(param, sigmoid);
+    auto mul = std::make_shared<ov::opset1::Multiply>(add, sigmoid);
+    auto snippetModel = std::make_shared<ov::Model>(ov::OutputVector{mul}, ov::ParameterVector{param});
+
+    ov::Core ie;
+    const int streams = 4;
+    ov::CompiledModel compiledModel = ie.compile_model(snippetModel, deviceName, {ov::num_streams(streams)});
+    std::map<std::string, uint64_t> statistics;
+    ASSERT_NO_THROW(statistics = compiledModel.get_property(ov::intel_cpu::snippets_cache_statistics));
+    ASSERT_EQ(statistics.size(), 3);
+    // the graphs of the streams are compiled concurrently, so the code may be generated by several of them
+    ASSERT_GE(statistics["misses"], 1);
+    ASSERT_EQ(statistics["hits"] + statistics["misses"], streams);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSharedWorkspace) {
+    ov::Core ie;
+    ov::CompiledModel refModel = ie.compile_model(model, deviceName, {ov::num_streams(1)});
+    ov::AnyMap config;
+    config[ov::intel_cpu::shared_workspace.name()] = true;
+    config[ov::num_streams.name()] = 4;
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName, config);
+
+    auto refRequest = refModel.create_infer_request();
+    std::vector<ov::InferRequest> requests;
+    std::vector<ov::Tensor> expected;
+    for (size_t r = 0; r < 8; r++) {
+        ov::Tensor input(model->input().get_element_type(), model->input().get_shape());
+        auto data = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++)
+            data[i] = static_cast<float>((i + r * 7) % 23) - 11.0f;
+        refRequest.set_input_tensor(input);
+        refRequest.infer();
+        ov::Tensor output(refRequest.get_output_tensor().get_element_type(), refRequest.get_output_tensor().get_shape());
+        refRequest.get_output_tensor().copy_to(output);
+        expected.push_back(output);
+
+        requests.push_back(compiledModel.create_infer_request());
+        requests.back().set_input_tensor(input);
+    }
+    // the requests run on the streams concurrently and share the arenas of the pool
+    for (size_t iteration = 0; iteration < 3; iteration++) {
+        for (auto& request : requests)
+            request.start_async();
+        for (size_t r = 0; r < requests.size(); r++) {
+            requests[r].wait();
+            const auto actual = requests[r].get_output_tensor();
+            ASSERT_EQ(expected[r].get_size(), actual.get_size());
+            for (size_t i = 0; i < actual.get_size(); i++)
+                ASSERT_NEAR(expected[r].data<float>()[i], actual.data<float>()[i], 1e-4f);
+        }
+    }
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSharedRuntimeCachePillowInterpolate) {
+    // the pillow interpolation executors keep the working buffer, so they must not be shared by the streams
+    auto param = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 8, 40, 40});
+    auto sizes = ov::opset1::Constant::create(ov::element::i32, ov::Shape{2}, {17, 23});
+    auto axes = ov::opset1::Constant::create(ov::element::i32, ov::Shape{2}, {2, 3});
+    ov::op::v11::Interpolate::InterpolateAttrs attrs;
+    attrs.mode = ov::op::v11::Interpolate::InterpolateMode::BILINEAR_PILLOW;
+    attrs.shape_calculation_mode = ov::op::v11::Interpolate::ShapeCalcMode::SIZES;
+    attrs.pads_begin = {0, 0, 0, 0};
+    attrs.pads_end = {0, 0, 0, 0};
+    auto interpolate = std::make_shared<ov::op::v11::Interpolate>(param, sizes, axes, attrs);
+    auto interpolateModel = std::make_shared<ov::Model>(ov::OutputVector{interpolate}, ov::ParameterVector{param});
+
+    ov::Core ie;
+    ov::CompiledModel refModel = ie.compile_model(interpolateModel, deviceName, {ov::num_streams(1)});
+    ov::AnyMap config;
+    config[ov::intel_cpu::shared_runtime_cache.name()] = true;
+    config[ov::num_streams.name()] = 4;
+    ov::CompiledModel compiledModel = ie.compile_model(interpolateModel, deviceName, config);
+
+    auto refRequest = refModel.create_infer_request();
+    std::vector<ov::InferRequest> requests;
+    std::vector<ov::Tensor> expected;
+    for (size_t r = 0; r < 8; r++) {
+        ov::Tensor input(ov::element::f32, param->get_shape());
+        auto data = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++)
+            data[i] = static_cast<float>((i * 3 + r * 11) % 29);
+        refRequest.set_input_tensor(input);
+        refRequest.infer();
+        ov::Tensor output(refRequest.get_output_tensor().get_element_type(), refRequest.get_output_tensor().get_shape());
+        refRequest.get_output_tensor().copy_to(output);
+        expected.push_back(output);
+
+        requests.push_back(compiledModel.create_infer_request());
+        requests.back().set_input_tensor(input);
+    }
+    // the requests with the different inputs run on the streams concurrently
+    for (size_t iteration = 0; iteration < 10; iteration++) {
+        for (auto& request : requests)
+            request.start_async();
+        for (size_t r = 0; r < requests.size(); r++) {
+            requests[r].wait();
+            const auto actual = requests[r].get_output_tensor();
+            ASSERT_EQ(expected[r].get_size(), actual.get_size());
+            for (size_t i = 0; i < actual.get_size(); i++)
+                ASSERT_NEAR(expected[r].data<float>()[i], actual.data<float>()[i], 1e-4f);
+        }
+    }
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckNumaWeightsBinding) {
+    ov::Core ie;
+    ov::AnyMap config;
+    config[ov::intel_cpu::numa_weights_binding.name()] = true;
+    config[ov::num_streams.name()] = 2;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName, config);
+    std::map<std::string, uint64_t> statistics;
+    ASSERT_NO_THROW(statistics = compiledModel.get_property(ov::intel_cpu::weights_memory_statistics));
+    ASSERT_EQ(statistics.size(), InferenceEngine::getAvailableNUMANodes().size());
+    uint64_t totalSize = 0;
+    for (const auto& size : statistics)
+        totalSize += size.second;
+    ASSERT_GT(totalSize, 0);
+}
+
 const auto bf16_if_can_be_emulated = InferenceEngine::with_cpu_x86_avx512_core() ? ov::element::bf16 : ov::element::f32;
 
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckExecutionModeIsAvailableInCoreAndModel) {
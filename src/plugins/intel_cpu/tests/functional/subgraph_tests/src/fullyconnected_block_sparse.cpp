@@ -0,0 +1,95 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_system_conf.h"
+#include "ngraph_functions/builders.hpp"
+#include "openvino/opsets/opset1.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+ * Only every 4th input channel has non-zero weights, so the most of the (block x 1) columns of the weights are zero
+ * and FullyConnected is executed by the block sparse kernel. The output channels number is not a multiple of the block
+ * to cover the tail block, the rows number covers the tail rows of the kernel.
+ *
+ *   Input   Weights[OC, IC]
+ *      \      /
+ *       MatMul   Bias[1, OC]
+ *          \      /
+ *            Add
+ *             |
+ *           Result
+ */
+class FullyConnectedBlockSparseCPUTest : public testing::WithParamInterface<InputShape>,
+                                         virtual public SubgraphBaseTest,
+                                         public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InputShape>& obj) {
+        const auto& inputShape = obj.param;
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_TS=";
+        for (const auto& shape : inputShape.second)
+            result << "(" << CommonTestUtils::vec2str(shape) << ")_";
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        init_input_shapes({GetParam()});
+
+        const size_t IC = 64, OC = 37;
+        std::vector<float> weights(OC * IC, 0.f);
+        for (size_t oc = 0; oc < OC; oc++) {
+            for (size_t ic = 0; ic < IC; ic += 4)
+                weights[oc * IC + ic] = static_cast<float>((oc + ic) % 7) - 3.f;
+        }
+        std::vector<float> bias(OC);
+        for (size_t oc = 0; oc < OC; oc++)
+            bias[oc] = static_cast<float>(oc % 5);
+
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        auto matMul = std::make_shared<ov::opset1::MatMul>(
+            params[0], ov::opset1::Constant::create(ov::element::f32, ov::Shape{OC, IC}, weights), false, true);
+        auto add = std::make_shared<ov::opset1::Add>(
+            matMul, ov::opset1::Constant::create(ov::element::f32, ov::Shape{1, OC}, bias));
+        function = makeNgraphFunction(ov::element::f32, params, add, "FullyConnectedBlockSparse");
+
+        configuration.insert({ov::intel_cpu::sparse_weights_decompression_rate.name(), 0.5f});
+        selectedType = makeSelectedTypeStr(InferenceEngine::with_cpu_x86_avx512_core() ? "jit_avx512" : "jit_avx2",
+                                           ov::element::f32);
+        // the products are summed in a different order by the kernel
+        rel_threshold = 1e-4f;
+    }
+};
+
+TEST_P(FullyConnectedBlockSparseCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        GTEST_SKIP();
+
+    run();
+    CheckPluginRelatedResults(compiledModel, "FullyConnected");
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{}, {{21, 64}}},
+    {{-1, 64}, {{21, 64}, {8, 64}, {3, 64}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FullyConnectedBlockSparse,
+                         FullyConnectedBlockSparseCPUTest,
+                         ::testing::ValuesIn(inputShapes),
+                         FullyConnectedBlockSparseCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,143 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_system_conf.h"
+#include "ngraph_functions/builders.hpp"
+#include "openvino/opsets/opset1.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+ * Weights [OC, IC] = (weights[OC, groups, IC / groups] - zero point[OC, groups, 1]) * scale[OC, groups, 1]
+ *
+ *   Weights(u8/i8)
+ *        |
+ *     Convert   ZeroPoint
+ *         \      /
+ *         Subtract   Scale
+ *             \      /
+ *             Multiply
+ *                |
+ *   Input    [Reshape]
+ *      \       /
+ *       MatMul
+ *         |
+ *       Result
+ */
+using FullyConnectedWeightsDecompressionParams = std::tuple<InputShape,         // input shape
+                                                            ov::element::Type,  // weights precision
+                                                            size_t,             // groups number
+                                                            bool>;              // with zero point
+
+class FullyConnectedWeightsDecompressionCPUTest
+    : public testing::WithParamInterface<FullyConnectedWeightsDecompressionParams>,
+      virtual public SubgraphBaseTest,
+      public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FullyConnectedWeightsDecompressionParams>& obj) {
+        InputShape inputShape;
+        ov::element::Type weightsType;
+        size_t groups;
+        bool withZeroPoint;
+        std::tie(inputShape, weightsType, groups, withZeroPoint) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_TS=";
+        for (const auto& shape : inputShape.second)
+            result << "(" << CommonTestUtils::vec2str(shape) << ")_";
+        result << "WP=" << weightsType << "_groups=" << groups << "_ZP=" << withZeroPoint;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape;
+        ov::element::Type weightsType;
+        size_t groups;
+        bool withZeroPoint;
+        std::tie(inputShape, weightsType, groups, withZeroPoint) = GetParam();
+        init_input_shapes({inputShape});
+
+        const size_t IC = 64, OC = 37;
+        const size_t groupSize = IC / groups;
+        const bool isSigned = weightsType == ov::element::i8;
+        std::vector<int32_t> weights(OC * IC);
+        for (size_t i = 0; i < weights.size(); i++)
+            weights[i] = static_cast<int32_t>(i * 7 % 255) - (isSigned ? 128 : 0);
+        std::vector<float> scales(OC * groups), zeroPoints(OC * groups);
+        for (size_t i = 0; i < scales.size(); i++) {
+            scales[i] = 0.01f * static_cast<float>(i % 13 + 1);
+            zeroPoints[i] = static_cast<float>(i % 5 + 120);
+        }
+
+        const ov::Shape groupedShape = groups == 1 ? ov::Shape{OC, IC} : ov::Shape{OC, groups, groupSize};
+        const ov::Shape constShape = groups == 1 ? ov::Shape{OC, 1} : ov::Shape{OC, groups, 1};
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        std::shared_ptr<ov::Node> decompressed = std::make_shared<ov::opset1::Convert>(
+            ov::opset1::Constant::create(weightsType, groupedShape, weights), ov::element::f32);
+        if (withZeroPoint) {
+            decompressed = std::make_shared<ov::opset1::Subtract>(
+                decompressed, ov::opset1::Constant::create(ov::element::f32, constShape, zeroPoints));
+        }
+        decompressed = std::make_shared<ov::opset1::Multiply>(
+            decompressed, ov::opset1::Constant::create(ov::element::f32, constShape, scales));
+        if (groups != 1) {
+            decompressed = std::make_shared<ov::opset1::Reshape>(
+                decompressed, ov::opset1::Constant::create(ov::element::i64, ov::Shape{2}, {OC, IC}), false);
+        }
+        auto matMul = std::make_shared<ov::opset1::MatMul>(params[0], decompressed, false, true);
+        function = makeNgraphFunction(ov::element::f32, params, matMul, "FullyConnectedWeightsDecompression");
+
+        // the decompression is fused only with the f32 inference precision, which isn't the default on bf16 platforms
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+        selectedType = makeSelectedTypeStr(InferenceEngine::with_cpu_x86_avx512_core() ? "jit_avx512" : "jit_avx2",
+                                           ov::element::f32);
+        // the products are summed in a different order by the kernel
+        rel_threshold = 1e-4f;
+    }
+};
+
+TEST_P(FullyConnectedWeightsDecompressionCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        GTEST_SKIP();
+
+    run();
+    CheckPluginRelatedResults(compiledModel, "FullyConnected");
+    // the decompression subgraph is fused, the weights are passed to FullyConnected in the low precision
+    CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{-1, 64}, {{1, 64}, {6, 64}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FullyConnectedWeightsDecompression_GroupedU8,
+                         FullyConnectedWeightsDecompressionCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(ov::element::u8),
+                                            ::testing::Values(4),
+                                            ::testing::Values(true)),
+                         FullyConnectedWeightsDecompressionCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FullyConnectedWeightsDecompression_PerChannelI8,
+                         FullyConnectedWeightsDecompressionCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(ov::element::i8),
+                                            ::testing::Values(1),
+                                            ::testing::Values(false)),
+                         FullyConnectedWeightsDecompressionCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,104 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/opsets/opset6.hpp"
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+constexpr size_t size = 16;
+}  // namespace
+
+// The state accumulates the inputs: state = state + input, the output is the new state
+class MemoryDoubleBufferedStateCPUTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto input = std::make_shared<ov::opset6::Parameter>(ov::element::f32, ov::Shape{1, size});
+        input->get_output_tensor(0).set_names({"input"});
+        auto init = ov::opset6::Constant::create(ov::element::f32, ov::Shape{1, size}, {0.f});
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{ov::PartialShape{1, size}, ov::element::f32, "sum"});
+        auto readValue = std::make_shared<ov::opset6::ReadValue>(init, variable);
+        auto add = std::make_shared<ov::opset6::Add>(readValue, input);
+        auto assign = std::make_shared<ov::opset6::Assign>(add, variable);
+        auto result = std::make_shared<ov::opset6::Result>(add);
+        result->get_output_tensor(0).set_names({"sum"});
+        auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign},
+                                                 ov::ParameterVector{input});
+
+        auto core = ov::test::utils::PluginCache::get().core();
+        request = core->compile_model(model, "CPU").create_infer_request();
+    }
+
+    void infer(float value) {
+        ov::Tensor inputTensor(ov::element::f32, ov::Shape{1, size});
+        std::fill_n(inputTensor.data<float>(), size, value);
+        request.set_tensor("input", inputTensor);
+        request.infer();
+    }
+
+    ov::VariableState getState() {
+        auto states = request.query_state();
+        EXPECT_EQ(1ul, states.size());
+        return states[0];
+    }
+
+    static void checkValues(const ov::Tensor& tensor, float expected) {
+        ASSERT_EQ((ov::Shape{1, size}), tensor.get_shape());
+        for (size_t i = 0; i < size; i++)
+            ASSERT_EQ(expected, tensor.data<float>()[i]) << "at " << i;
+    }
+
+    ov::InferRequest request;
+};
+
+TEST_F(MemoryDoubleBufferedStateCPUTest, StateAfterTwoInfers) {
+    infer(1.f);
+    infer(2.f);
+    checkValues(request.get_tensor("sum"), 3.f);
+    checkValues(getState().get_state(), 3.f);
+}
+
+TEST_F(MemoryDoubleBufferedStateCPUTest, SetStateBeforeInfer) {
+    infer(1.f);
+    ov::Tensor newState(ov::element::f32, ov::Shape{1, size});
+    std::fill_n(newState.data<float>(), size, 10.f);
+    getState().set_state(newState);
+    checkValues(getState().get_state(), 10.f);
+
+    infer(1.f);
+    checkValues(request.get_tensor("sum"), 11.f);
+    checkValues(getState().get_state(), 11.f);
+    infer(1.f);
+    checkValues(getState().get_state(), 12.f);
+}
+
+TEST_F(MemoryDoubleBufferedStateCPUTest, ResetBetweenInfers) {
+    infer(1.f);
+    infer(1.f);
+    getState().reset();
+    checkValues(getState().get_state(), 0.f);
+
+    infer(1.f);
+    checkValues(request.get_tensor("sum"), 1.f);
+    infer(1.f);
+    checkValues(getState().get_state(), 2.f);
+}
+
+// the state returned to the user is a snapshot, so it isn't changed by the next inferences reusing the buffers
+TEST_F(MemoryDoubleBufferedStateCPUTest, HeldStateIsStable) {
+    infer(1.f);
+    const auto held = getState().get_state();
+    checkValues(held, 1.f);
+
+    infer(1.f);
+    infer(1.f);
+    checkValues(held, 1.f);
+    checkValues(getState().get_state(), 3.f);
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,58 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/opsets/opset6.hpp"
+
+namespace SubgraphTestsDefinitions {
+
+// The state keeps the history of all the inputs: state = concat(state, input), so it grows by one row every step
+TEST(MemoryGrowingStateCPUTest, StateIsAppendedEveryStep) {
+    const size_t rowSize = 4;
+    auto input = std::make_shared<ov::opset6::Parameter>(ov::element::f32, ov::PartialShape{1, -1, rowSize});
+    input->get_output_tensor(0).set_names({"input"});
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{ov::PartialShape{1, -1, rowSize}, ov::element::f32, "history"});
+    auto readValue = std::make_shared<ov::opset6::ReadValue>(input, variable);
+    auto concat = std::make_shared<ov::opset6::Concat>(ov::OutputVector{readValue, input}, 1);
+    auto assign = std::make_shared<ov::opset6::Assign>(concat, variable);
+    auto result = std::make_shared<ov::opset6::Result>(concat);
+    result->get_output_tensor(0).set_names({"history"});
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign},
+                                             ov::ParameterVector{input});
+
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto request = core->compile_model(model, "CPU").create_infer_request();
+
+    const size_t steps = 5;
+    for (size_t step = 0; step < steps; step++) {
+        ov::Tensor inputTensor(ov::element::f32, ov::Shape{1, 1, rowSize});
+        std::fill_n(inputTensor.data<float>(), rowSize, static_cast<float>(step));
+        request.set_tensor("input", inputTensor);
+        request.infer();
+
+        const auto output = request.get_tensor("history");
+        ASSERT_EQ((ov::Shape{1, step + 1, rowSize}), output.get_shape());
+        for (size_t row = 0; row <= step; row++) {
+            for (size_t i = 0; i < rowSize; i++)
+                ASSERT_EQ(static_cast<float>(row), output.data<float>()[row * rowSize + i]);
+        }
+
+        auto states = request.query_state();
+        ASSERT_EQ(1ul, states.size());
+        ASSERT_EQ((ov::Shape{1, step + 1, rowSize}), states[0].get_state().get_shape());
+    }
+
+    // the reset state is empty again
+    request.query_state()[0].reset();
+    ov::Tensor inputTensor(ov::element::f32, ov::Shape{1, 1, rowSize});
+    std::fill_n(inputTensor.data<float>(), rowSize, 42.f);
+    request.set_tensor("input", inputTensor);
+    request.infer();
+    ASSERT_EQ((ov::Shape{1, 1, rowSize}), request.get_tensor("history").get_shape());
+}
+
+}  // namespace SubgraphTestsDefinitions
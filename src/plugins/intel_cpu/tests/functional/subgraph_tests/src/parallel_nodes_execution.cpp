@@ -0,0 +1,62 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Motivation:
+// In the parallel nodes execution mode the independent branches of a static graph are executed concurrently.
+// The test checks that the branches which share the same input (and may share memory via in-place optimizations)
+// produce the correct results.
+
+//                 -------
+//                 |input|
+//                 -------
+//        /           |           \
+//  ----------    ----------    ----------
+//  |matmul 0|    |matmul 1|    |  relu  |
+//  ----------    ----------    ----------
+//      |             |             |
+//  ----------    ----------        |
+//  |  add 0 |    |  add 1 |        |
+//  ----------    ----------        |
+//        \           |           /
+//         ------------------------
+//         |        concat        |
+//         ------------------------
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "internal_properties.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+class ParallelNodesExecution : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({ov::intel_cpu::parallel_nodes_execution.name(), InferenceEngine::PluginConfigParams::YES});
+
+        const auto ngPrc = element::f32;
+        const size_t branchesCount = 2;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 8, 16}});
+
+        NodeVector concatInputs;
+        for (size_t i = 0; i < branchesCount; i++) {
+            const auto weights = builder::makeConstant(ngPrc, std::vector<size_t>{16, 16}, std::vector<float>{}, true);
+            const auto matMul = builder::makeMatMul(inputParams[0], weights, false, true);
+            const auto bias = builder::makeConstant(ngPrc, std::vector<size_t>{1, 1, 16}, std::vector<float>{}, true);
+            concatInputs.push_back(builder::makeEltwise(matMul, bias, helpers::EltwiseTypes::ADD));
+        }
+        concatInputs.push_back(builder::makeActivation(inputParams[0], ngPrc, helpers::ActivationTypes::Relu));
+
+        const auto concat = std::make_shared<opset1::Concat>(concatInputs, 1);
+        function = std::make_shared<Function>(NodeVector{concat}, inputParams, "ParallelNodesExecution");
+    }
+};
+
+TEST_F(ParallelNodesExecution, smoke_CompareWithRefs) {
+    Run();
+}
+
+} // namespace SubgraphTestsDefinitions
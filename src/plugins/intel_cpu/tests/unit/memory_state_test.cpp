@@ -0,0 +1,43 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory_state.h>
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+// A row of the state takes 16 bytes and the capacity of a buffer is rounded up to a power of two
+TEST(VariableStateTest, BufferIsReusedWhileItHasCapacity) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto storage = std::make_shared<Memory>(eng);
+    storage->Create(std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape{1, 0, 4}));
+    VariableState state("history", storage, true);
+
+    auto setRows = [&](size_t rows) {
+        auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, rows, 4}, Layout::CHW));
+        blob->allocate();
+        std::fill_n(blob->buffer().as<float*>(), blob->size(), static_cast<float>(rows));
+        state.SetState(blob);
+        EXPECT_EQ((VectorDims{1, rows, 4}), state.getCurrent()->getStaticDims());
+        EXPECT_EQ(static_cast<float>(rows), static_cast<const float*>(state.getCurrent()->GetData())[0]);
+        return state.getCurrent()->GetData();
+    };
+
+    const auto data = setRows(3);
+    ASSERT_EQ(data, setRows(4));
+    // the capacity is kept when the state shrinks
+    ASSERT_EQ(data, setRows(1));
+    ASSERT_EQ(data, setRows(4));
+
+    const auto grown = setRows(5);
+    ASSERT_NE(data, grown);
+    ASSERT_EQ(grown, setRows(8));
+
+    // the reset state is empty again, but the capacity is kept
+    state.Reset();
+    ASSERT_EQ((VectorDims{1, 0, 4}), state.getCurrent()->getStaticDims());
+    ASSERT_EQ(grown, setRows(6));
+}
@@ -9,6 +9,7 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/sharded_lru_cache.h"
 
 using namespace ov::intel_cpu;
 
@@ -379,3 +380,140 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(ShardedLruCacheTests, PutIfAbsent) {
+    constexpr int capacity = 64;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i <= capacity; ++i) {
+        ASSERT_EQ(cache.putIfAbsent({i}, i), i);
+    }
+
+    // the first stored value is kept
+    for (int i = 1; i <= capacity; ++i) {
+        ASSERT_EQ(cache.putIfAbsent({i}, -i), i);
+        ASSERT_EQ(cache.get({i}), i);
+    }
+}
+
+TEST(ShardedLruCacheTests, Evict) {
+    constexpr int capacity = 16;
+    ShardedLruCache<IntKey, int> cache(capacity, 4);
+    for (int i = 1; i <= 4 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.putIfAbsent({i}, i));
+    }
+    ASSERT_GE(cache.getEvictionsCount(), static_cast<size_t>(3 * capacity));
+}
+
+TEST(ShardedLruCacheTests, Empty) {
+    ShardedLruCache<IntKey, int> cache(0);
+    ASSERT_EQ(cache.putIfAbsent({10}, 10), 10);
+    ASSERT_EQ(cache.get({10}), int());
+    ASSERT_EQ(cache.getEvictionsCount(), 0ul);
+}
+
+TEST(MultiCacheTests, Statistics) {
+    constexpr int capacity = 10;
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits, static_cast<size_t>(capacity));
+    ASSERT_EQ(stats.misses, static_cast<size_t>(2 * capacity));
+    ASSERT_EQ(stats.evictions, static_cast<size_t>(capacity));
+}
+
+TEST(MultiCacheTests, SharedSmoke) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int numKeys = 100;
+    constexpr size_t numThreads = 30;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    // the capacity is large enough to keep all the keys even if they are mapped to the same shard
+    MultiCache cache(numKeys * ShardedLruCache<IntKey, IntValueType>::defaultShardsNumber, true);
+    std::vector<std::vector<IntValueType>> results(numThreads);
+
+    auto testRoutine = [&](size_t threadIdx) {
+        for (int i = 0; i < numKeys; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+            results[threadIdx].push_back(intResult.first);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine, i));
+        }
+    }
+
+    // all the threads must get the same cached objects
+    for (size_t i = 1; i < numThreads; ++i) {
+        ASSERT_EQ(results[i], results[0]);
+    }
+
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits + stats.misses, numThreads * numKeys);
+    ASSERT_EQ(stats.evictions, 0ul);
+}
+
+namespace {
+struct PrivateIntKey {
+    size_t hash() const {
+        return std::hash<int>().operator()(data);
+    }
+    bool operator==(const PrivateIntKey& rhs) const noexcept {
+        return this->data == rhs.data;
+    }
+
+    static constexpr bool sharedCacheAllowed = false;
+
+    int data;
+};
+} // namespace
+
+TEST(MultiCacheTests, ForwardShareableKeysToSharedCache) {
+    using IntValueType = std::shared_ptr<int>;
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto privateBuilder = [&](const PrivateIntKey& key) { return std::make_shared<int>(key.data); };
+
+    ASSERT_TRUE(IsShareableCacheKey<IntKey>::value);
+    ASSERT_FALSE(IsShareableCacheKey<PrivateIntKey>::value);
+
+    auto sharedCache = std::make_shared<MultiCache>(10, true);
+    MultiCache firstStreamCache(10, sharedCache);
+    MultiCache secondStreamCache(10, sharedCache);
+
+    // the shareable values are built once for all the streams
+    const IntValueType sharedValue = firstStreamCache.getOrCreate(IntKey{1}, intBuilder).first;
+    auto result = secondStreamCache.getOrCreate(IntKey{1}, intBuilder);
+    ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Hit);
+    ASSERT_EQ(result.first, sharedValue);
+
+    // the values of the opted out keys are built by every stream and are reused inside the stream only
+    const IntValueType firstValue = firstStreamCache.getOrCreate(PrivateIntKey{1}, privateBuilder).first;
+    result = secondStreamCache.getOrCreate(PrivateIntKey{1}, privateBuilder);
+    ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_NE(result.first, firstValue);
+    result = firstStreamCache.getOrCreate(PrivateIntKey{1}, privateBuilder);
+    ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Hit);
+    ASSERT_EQ(result.first, firstValue);
+
+    const auto sharedStats = sharedCache->getStatistics();
+    ASSERT_EQ(sharedStats.hits, 1ul);
+    ASSERT_EQ(sharedStats.misses, 1ul);
+    const auto firstStats = firstStreamCache.getStatistics();
+    ASSERT_EQ(firstStats.hits, 1ul);
+    ASSERT_EQ(firstStats.misses, 1ul);
+}
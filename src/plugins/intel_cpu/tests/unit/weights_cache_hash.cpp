@@ -0,0 +1,62 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+// bytewise ECMA-182 CRC64 used as a reference for the buffers hashed in one chunk
+uint64_t referenceCrc64(const unsigned char* data, size_t size) {
+    uint64_t table[256];
+    for (int i = 0; i < 256; i++) {
+        uint64_t c = i;
+        for (int j = 0; j < 8; j++)
+            c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
+        table[i] = c;
+    }
+    uint64_t crc = 0;
+    for (size_t idx = 0; idx < size; idx++)
+        crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
+    return ~crc;
+}
+
+std::vector<unsigned char> makeData(size_t size) {
+    std::vector<unsigned char> data(size);
+    for (size_t i = 0; i < size; i++)
+        data[i] = static_cast<unsigned char>((i * 2654435761u) >> 13);
+    return data;
+}
+} // namespace
+
+TEST(WeightsCacheHashTests, SmallBuffersMatchCrc64) {
+    const auto& hashFunc = WeightsSharing::GetHashFunc();
+    const auto data = makeData(4099);
+    for (size_t size : {0, 1, 7, 8, 9, 63, 64, 65, 4099}) {
+        ASSERT_EQ(hashFunc.hash(data.data(), size), referenceCrc64(data.data(), size)) << "size: " << size;
+    }
+}
+
+TEST(WeightsCacheHashTests, LargeBuffersAreStable) {
+    const auto& hashFunc = WeightsSharing::GetHashFunc();
+    // several chunks with a tail
+    auto data = makeData((5 << 20) + 123);
+
+    const auto hash = hashFunc.hash(data.data(), data.size());
+    ASSERT_EQ(hash, hashFunc.hash(data.data(), data.size()));
+
+    // any changed byte changes the hash
+    for (size_t idx : {static_cast<size_t>(0), static_cast<size_t>(3 << 20), data.size() - 1}) {
+        data[idx] ^= 0x1;
+        ASSERT_NE(hash, hashFunc.hash(data.data(), data.size())) << "index: " << idx;
+        data[idx] ^= 0x1;
+    }
+
+    // the size is a part of the hash
+    ASSERT_NE(hash, hashFunc.hash(data.data(), data.size() - 1));
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <numeric>
+
+#include <common/memory_desc_wrapper.hpp>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "dnnl_extension_utils.h"
+#include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "weights_disk_cache.hpp"
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+class WeightsDiskCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        cacheDir = CommonTestUtils::generateTestFilePrefix() + "_weights_cache";
+        desc = std::make_shared<DnnlBlockedMemoryDesc>(Precision::FP32, Shape(VectorDims{4, 16}));
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "cpuw");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    MemoryPtr createMemory(float startValue) {
+        auto memory = std::make_shared<Memory>(eng);
+        memory->Create(desc);
+        auto data = static_cast<float*>(memory->GetData());
+        std::iota(data, data + desc->getShape().getElementsCount(), startValue);
+        return memory;
+    }
+
+    std::string cacheDir;
+    DnnlMemoryDescPtr desc;
+    dnnl::engine eng{dnnl::engine::kind::cpu, 0};
+};
+}  // namespace
+
+TEST_F(WeightsDiskCacheTest, StoredWeightsAreMapped) {
+    WeightsDiskCache cache(cacheDir);
+    const auto key = "weights_" + WeightsDiskCache::describe(desc);
+
+    size_t createCalls = 0;
+    auto create = [&]() {
+        createCalls++;
+        return createMemory(1.0f);
+    };
+
+    auto created = cache.findOrCreate(key, desc, eng, create);
+    ASSERT_EQ(1ul, createCalls);
+
+    // another cache instance emulates the next process
+    WeightsDiskCache otherCache(cacheDir);
+    auto loaded = otherCache.findOrCreate(key, desc, eng, create);
+    ASSERT_EQ(1ul, createCalls);
+    ASSERT_NE(created->GetData(), loaded->GetData());
+    ASSERT_EQ(created->GetSize(), loaded->GetSize());
+    ASSERT_EQ(0, std::memcmp(created->GetData(), loaded->GetData(), created->GetSize()));
+
+    // a different key must not reuse the record
+    auto other = otherCache.findOrCreate(key + "_other", desc, eng, [&]() {
+        createCalls++;
+        return createMemory(2.0f);
+    });
+    ASSERT_EQ(2ul, createCalls);
+    ASSERT_EQ(2.0f, static_cast<float*>(other->GetData())[0]);
+}
+
+TEST_F(WeightsDiskCacheTest, UndefinedLayoutIsNotDescribed) {
+    auto undefinedDesc = std::make_shared<DnnlBlockedMemoryDesc>(Precision::FP32, Shape(ov::PartialShape{-1, 16}));
+    ASSERT_TRUE(WeightsDiskCache::describe(undefinedDesc).empty());
+    ASSERT_FALSE(WeightsDiskCache::describe(desc).empty());
+}
+
+// e.g. the int8 weights reordered on the host without VNNI are scaled, the layout must tell it
+TEST_F(WeightsDiskCacheTest, ExtraIsDescribed) {
+    dnnl::memory::desc plain({4, 16}, dnnl::memory::data_type::s8, dnnl::memory::format_tag::ab);
+    dnnl::memory::desc adjusted({4, 16}, dnnl::memory::data_type::s8, dnnl::memory::format_tag::ab);
+    adjusted.get()->extra.flags = dnnl::impl::memory_extra_flags::scale_adjust;
+    adjusted.get()->extra.scale_adjust = 0.5f;
+
+    const auto plainLayout = WeightsDiskCache::describe(DnnlExtensionUtils::makeDescriptor(plain));
+    const auto adjustedLayout = WeightsDiskCache::describe(DnnlExtensionUtils::makeDescriptor(adjusted));
+    ASSERT_FALSE(plainLayout.empty());
+    ASSERT_FALSE(adjustedLayout.empty());
+    ASSERT_NE(plainLayout, adjustedLayout);
+}